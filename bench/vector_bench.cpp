@@ -0,0 +1,398 @@
+/**
+ * @file vector_bench.cpp
+ * @brief Benchmarks de sc::vector, tendo std::vector como referência.
+ *
+ * Execute com saída JSON para acompanhar regressões:
+ *
+ *     ./bench --benchmark_out=bench.json --benchmark_out_format=json
+ *
+ * ou `make bench_json`, que grava bench.json na pasta de build.
+*/
+
+#include <algorithm>            // std::find, std::min_element, std::sort
+#include <cstddef>              // std::size_t
+#include <mutex>                // std::mutex, std::lock_guard
+#include <numeric>              // std::accumulate
+#include <string>               // std::string
+#include <vector>               // std::vector
+
+#include <benchmark/benchmark.h>
+
+#include "concurrent_vector.h"
+#include "parallel.h"
+#include "vector.h"
+
+// ============================================================================
+// ELEMENT TYPES
+// ============================================================================
+
+/// 64 bytes, trivially copyable.
+struct Big {
+    long fields[8];
+};
+
+template < typename T >
+T make_value( std::size_t i );
+
+template <>
+int make_value<int>( std::size_t i ) { return static_cast<int>( i ); }
+
+template <>
+std::string make_value<std::string>( std::size_t i )
+{
+    // Long enough to defeat the small string optimization.
+    return std::string( 32, 'a' + static_cast<char>( i % 26 ) );
+}
+
+template <>
+Big make_value<Big>( std::size_t i )
+{
+    Big b;
+    for ( auto & f : b.fields )
+        f = static_cast<long>( i );
+    return b;
+}
+
+std::size_t weight( int v ) { return static_cast<std::size_t>( v ); }
+std::size_t weight( const std::string & v ) { return v.size(); }
+std::size_t weight( const Big & v ) { return static_cast<std::size_t>( v.fields[0] ); }
+
+// ============================================================================
+// CONTAINER ADAPTERS (std::vector has no push_front)
+// ============================================================================
+
+template < typename T >
+void push_front( std::vector<T> & v, const T & value ) { v.insert( v.begin(), value ); }
+
+template < typename T >
+void push_front( sc::vector<T> & v, const T & value ) { v.push_front( value ); }
+
+// Searches: std::vector goes through the standard algorithms, sc::vector through the simd.h kernels.
+template < typename T >
+std::size_t find_index( const std::vector<T> & v, const T & value ) { return std::find( v.begin(), v.end(), value ) - v.begin(); }
+
+template < typename T >
+std::size_t find_index( const sc::vector<T> & v, const T & value ) { return sc::find( v, value ) - v.cbegin(); }
+
+template < typename T >
+long long sum_of( const std::vector<T> & v ) { return std::accumulate( v.begin(), v.end(), 0LL ); }
+
+template < typename T >
+long long sum_of( const sc::vector<T> & v ) { return sc::sum( v ); }
+
+template < typename T >
+T min_of( const std::vector<T> & v ) { return *std::min_element( v.begin(), v.end() ); }
+
+template < typename T >
+T min_of( const sc::vector<T> & v ) { return sc::min( v ); }
+
+// Bulk algorithms: std::vector runs the serial standard ones, sc::vector the parallel.h ones.
+template < typename T >
+void sort_all( std::vector<T> & v ) { std::sort( v.begin(), v.end() ); }
+
+template < typename T >
+void sort_all( sc::vector<T> & v ) { sc::parallel::sort( v ); }
+
+template < typename T >
+long long reduce_all( const std::vector<T> & v ) { return std::accumulate( v.begin(), v.end(), 0LL, []( long long a, T b ) { return a + b * b; } ); }
+
+template < typename T >
+long long reduce_all( const sc::vector<T> & v ) { return sc::parallel::reduce( v, 0LL, []( long long a, T b ) { return a + b * b; } ); }
+
+// Bulk append: std::vector through insert at the end, sc::vector through append_range.
+template < typename T >
+void append_all( std::vector<T> & v, const T * first, const T * last ) { v.insert( v.end(), first, last ); }
+
+template < typename T >
+void append_all( sc::vector<T> & v, const T * first, const T * last ) { v.append_range( first, last ); }
+
+template < typename V >
+V make_filled( std::size_t n )
+{
+    V v;
+    v.reserve( n );
+    for ( std::size_t i = 0 ; i < n ; ++i )
+        v.push_back( make_value<typename V::value_type>( i ) );
+    return v;
+}
+
+enum Where { Front, Middle, Back };
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+template < typename V >
+void PushBack( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    const auto value = make_value<typename V::value_type>( 7 );
+    for ( auto _ : state )
+    {
+        V v;
+        for ( std::size_t i = 0 ; i < n ; ++i )
+            v.push_back( value );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+template < typename V >
+void ReservePushBack( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    const auto value = make_value<typename V::value_type>( 7 );
+    for ( auto _ : state )
+    {
+        V v;
+        v.reserve( n );
+        for ( std::size_t i = 0 ; i < n ; ++i )
+            v.push_back( value );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+/// Appends a batch of n elements that is already in memory (e.g. a decoded network buffer).
+template < typename V >
+void AppendRange( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    const auto source = make_filled< std::vector<typename V::value_type> >( n );
+    for ( auto _ : state )
+    {
+        V v;
+        append_all( v, source.data(), source.data() + n );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+template < typename V >
+void PushFront( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    const auto value = make_value<typename V::value_type>( 7 );
+    for ( auto _ : state )
+    {
+        V v;
+        for ( std::size_t i = 0 ; i < n ; ++i )
+            push_front( v, value );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+/// Inserts one element at the given position of an n-element vector and erases it again.
+template < typename V, Where where >
+void InsertErase( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    const auto value = make_value<typename V::value_type>( 7 );
+    V v = make_filled<V>( n );
+    const std::size_t pos = where == Front ? 0 : where == Middle ? n / 2 : n;
+    for ( auto _ : state )
+    {
+        auto it = v.insert( v.begin() + pos, value );
+        v.erase( it );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() );
+}
+
+template < typename V >
+void Iterate( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    for ( auto _ : state )
+    {
+        std::size_t sum = 0;
+        for ( const auto & e : v )
+            sum += weight( e );
+        benchmark::DoNotOptimize( sum );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+template < typename V >
+void Copy( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    for ( auto _ : state )
+    {
+        V copy( v );
+        benchmark::DoNotOptimize( copy.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+/// Compares two equal vectors (the worst case: every element is visited).
+template < typename V >
+void Equal( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V a = make_filled<V>( n );
+    V b = make_filled<V>( n );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( a == b );
+    state.SetBytesProcessed( state.iterations() * n * sizeof( typename V::value_type ) * 2 );
+}
+
+/// Looks for a value that is not there.
+template < typename V >
+void Find( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    const auto missing = make_value<typename V::value_type>( n + 1 );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( find_index( v, missing ) );
+    state.SetBytesProcessed( state.iterations() * n * sizeof( typename V::value_type ) );
+}
+
+template < typename V >
+void Sum( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( sum_of( v ) );
+    state.SetBytesProcessed( state.iterations() * n * sizeof( typename V::value_type ) );
+}
+
+template < typename V >
+void Min( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( min_of( v ) );
+    state.SetBytesProcessed( state.iterations() * n * sizeof( typename V::value_type ) );
+}
+
+/// Sorts a shuffled vector: std::sort on std::vector against sc::parallel::sort.
+template < typename V >
+void Sort( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V shuffled = make_filled<V>( n );
+    for ( std::size_t i = 0 ; i < n ; ++i )
+        shuffled[i] = static_cast<int>( ( i * 2654435761u ) % n );
+    for ( auto _ : state )
+    {
+        state.PauseTiming();
+        V v( shuffled );
+        state.ResumeTiming();
+        sort_all( v );
+        benchmark::DoNotOptimize( v.data() );
+    }
+    state.SetItemsProcessed( state.iterations() * n );
+}
+
+/// Sums the vector: std::accumulate on std::vector against sc::parallel::reduce.
+template < typename V >
+void Reduce( benchmark::State & state )
+{
+    const auto n = static_cast<std::size_t>( state.range( 0 ) );
+    V v = make_filled<V>( n );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( reduce_all( v ) );
+    state.SetBytesProcessed( state.iterations() * n * sizeof( typename V::value_type ) );
+}
+
+// Several threads appending to one shared container: sc::vector behind a
+// mutex against the lock-free sc::concurrent_vector. Thread 0 creates the
+// container before the loop and destroys it after (both are barriers).
+constexpr std::size_t appends_per_iteration = 1000;
+
+sc::vector<int> * g_locked = nullptr;
+std::mutex g_lock;
+sc::concurrent_vector<int> * g_concurrent = nullptr;
+
+void MutexPushBack( benchmark::State & state )
+{
+    if ( state.thread_index() == 0 )
+        g_locked = new sc::vector<int>();
+    for ( auto _ : state )
+    {
+        for ( std::size_t i = 0 ; i < appends_per_iteration ; ++i )
+        {
+            std::lock_guard<std::mutex> lock( g_lock );
+            g_locked->push_back( static_cast<int>( i ) );
+        }
+    }
+    if ( state.thread_index() == 0 )
+        delete g_locked;
+    state.SetItemsProcessed( state.iterations() * appends_per_iteration );
+}
+
+void ConcurrentPushBack( benchmark::State & state )
+{
+    if ( state.thread_index() == 0 )
+        g_concurrent = new sc::concurrent_vector<int>();
+    for ( auto _ : state )
+    {
+        for ( std::size_t i = 0 ; i < appends_per_iteration ; ++i )
+            benchmark::DoNotOptimize( g_concurrent->push_back( static_cast<int>( i ) ) );
+    }
+    if ( state.thread_index() == 0 )
+        delete g_concurrent;
+    state.SetItemsProcessed( state.iterations() * appends_per_iteration );
+}
+
+// ============================================================================
+// REGISTRATION: every benchmark over std::vector (baseline) and sc::vector,
+// for int, std::string and a 64-byte struct.
+// ============================================================================
+
+#define LINEAR_SIZES ->RangeMultiplier( 10 )->Range( 10, 10000000 )
+// push_front and front/middle insertion on a plain vector are O(n) per call.
+#define QUADRATIC_SIZES ->RangeMultiplier( 10 )->Range( 10, 100000 )
+
+#define BENCH_TYPE( func, T, sizes )                              \
+    BENCHMARK_TEMPLATE( func, std::vector<T> ) sizes;             \
+    BENCHMARK_TEMPLATE( func, sc::vector<T> ) sizes;
+
+#define BENCH_ALL( func, sizes )                                  \
+    BENCH_TYPE( func, int, sizes )                                \
+    BENCH_TYPE( func, std::string, sizes )                        \
+    BENCH_TYPE( func, Big, sizes )
+
+#define BENCH_TYPE_AT( func, T, where, sizes )                    \
+    BENCHMARK_TEMPLATE( func, std::vector<T>, where ) sizes;      \
+    BENCHMARK_TEMPLATE( func, sc::vector<T>, where ) sizes;
+
+#define BENCH_ALL_AT( func, where, sizes )                        \
+    BENCH_TYPE_AT( func, int, where, sizes )                      \
+    BENCH_TYPE_AT( func, std::string, where, sizes )              \
+    BENCH_TYPE_AT( func, Big, where, sizes )
+
+BENCH_ALL( PushBack, LINEAR_SIZES )
+BENCH_ALL( ReservePushBack, LINEAR_SIZES )
+BENCH_ALL( AppendRange, LINEAR_SIZES )
+BENCH_ALL( PushFront, QUADRATIC_SIZES )
+BENCH_ALL_AT( InsertErase, Front, LINEAR_SIZES )
+BENCH_ALL_AT( InsertErase, Middle, LINEAR_SIZES )
+BENCH_ALL_AT( InsertErase, Back, LINEAR_SIZES )
+BENCH_ALL( Iterate, LINEAR_SIZES )
+BENCH_ALL( Copy, LINEAR_SIZES )
+
+// Search and comparison kernels (simd.h) only apply to arithmetic types.
+BENCH_TYPE( Equal, int, LINEAR_SIZES )
+BENCH_TYPE( Find, int, LINEAR_SIZES )
+BENCH_TYPE( Sum, int, LINEAR_SIZES )
+BENCH_TYPE( Min, int, LINEAR_SIZES )
+
+// Parallel algorithms (parallel.h) only split vectors above serial_cutoff() (2^20 elements by default).
+#define PARALLEL_SIZES ->RangeMultiplier( 10 )->Range( 100000, 10000000 )->UseRealTime()
+BENCH_TYPE( Sort, int, PARALLEL_SIZES )
+BENCH_TYPE( Reduce, int, PARALLEL_SIZES )
+
+// A fixed iteration count bounds the size the shared container reaches.
+#define THREADS ->ThreadRange( 1, 8 )->Iterations( 2000 )->UseRealTime()
+BENCHMARK( MutexPushBack ) THREADS;
+BENCHMARK( ConcurrentPushBack ) THREADS;
+
+BENCHMARK_MAIN();
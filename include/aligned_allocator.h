@@ -0,0 +1,116 @@
+/**
+ * @file aligned_allocator.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Alocador com alinhamento de linha de cache e páginas enormes (huge pages) para sc::vector
+*/
+
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include <cstddef>              // std::size_t
+#include <cstdlib>              // std::aligned_alloc, std::free
+#include <limits>               // std::numeric_limits
+#include <new>                  // std::bad_alloc, std::bad_array_new_length
+#include <type_traits>          // std::true_type
+
+#include <sys/mman.h>           // madvise
+
+#include "growth.h"
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Alocador para sc::vector (ou qualquer container padrão) com blocos alinhados a Alignment bytes (64 por
+        * padrão: uma linha de cache, e a largura de um registrador AVX-512), para que cargas vetoriais sejam alinhadas
+        * e threads donas de blocos vizinhos não compartilhem linhas. Blocos a partir de HugePageBytes são alinhados e
+        * arredondados a HugePageBytes e marcados com madvise(MADV_HUGEPAGE), para que o kernel os sirva com páginas
+        * enormes transparentes (menos faltas de TLB em varreduras de vetores grandes).
+        *
+        * O alocador não toca a memória: as páginas são alocadas pelo kernel (política de primeiro toque, nos sistemas
+        * NUMA) quando sc::vector as escreve pela primeira vez. O alocador declara parallel_first_touch, e por isso, para
+        * T trivialmente copiável acima de parallel::serial_cutoff() elementos, essa escrita (zerar em resize, copiar,
+        * preencher ou transferir ao crescer) é dividida entre as threads do pool nos blocos de parallel::split, os
+        * mesmos de parallel::for_each. Com outros alocadores, todas essas escritas ficam na thread que chama.
+        * Como o pool rouba tarefas, a thread que escreve um bloco não é necessariamente a que depois o percorre: a
+        * distribuição das páginas pelos nós NUMA é só uma tentativa, não uma garantia.
+        *
+        * Use com growth::huge_page_rounded para que a capacidade também ocupe páginas enormes inteiras (ver huge_vector).
+        * @tparam T                Tipo dos elementos.
+        * @tparam Alignment        Alinhamento de todos os blocos, em bytes (potência de 2).
+        * @tparam HugePageBytes    Tamanho da página enorme; blocos menores usam páginas comuns. 0 desliga.
+        */
+        template <typename T, std::size_t Alignment = 64, std::size_t HugePageBytes = 2 * 1024 * 1024>
+        class aligned_allocator {
+            static_assert((Alignment & (Alignment - 1)) == 0 and Alignment >= alignof(T), "Alignment must be a power of two, at least alignof(T)");
+            static_assert((HugePageBytes & (HugePageBytes - 1)) == 0, "HugePageBytes must be a power of two");
+
+        public :
+            using value_type = T; //!< The value type.
+            using is_always_equal = std::true_type; //!< Any instance frees blocks of any other.
+            using parallel_first_touch = std::true_type; //!< sc::vector writes huge blocks for the first time on the thread pool.
+
+            static constexpr std::size_t alignment = Alignment; //!< Alinhamento dos blocos.
+            static constexpr std::size_t huge_page_bytes = HugePageBytes; //!< A partir deste tamanho, páginas enormes.
+
+            template <typename U>
+            struct rebind {
+                using other = aligned_allocator<U, Alignment, HugePageBytes>;
+            };
+
+            aligned_allocator( void ) = default;
+            template <typename U>
+            aligned_allocator( const aligned_allocator<U, Alignment, HugePageBytes> & ) noexcept { }
+
+            /**
+            * @brief Retorna um bloco alinhado para n elementos. Lança std::bad_alloc se não houver memória.
+            * @param n     Quantidade de elementos.
+            */
+            T * allocate( std::size_t n ){
+                if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                    throw std::bad_array_new_length();
+                std::size_t bytes = n * sizeof(T);
+                bool huge = HugePageBytes != 0 and bytes >= HugePageBytes;
+                std::size_t align = huge ? HugePageBytes : Alignment;
+                // aligned_alloc exige um tamanho múltiplo do alinhamento.
+                bytes = (bytes + align - 1) & ~(align - 1);
+                void *p = std::aligned_alloc(align, bytes);
+                if(p == nullptr)
+                    throw std::bad_alloc();
+                if(huge)
+                    madvise(p, bytes, MADV_HUGEPAGE); // só um aviso: sem THP, o bloco continua válido
+                return static_cast<T *>(p);
+            }
+            /**
+            * @brief Libera um bloco obtido com allocate().
+            * @param p     Bloco.
+            */
+            void deallocate( T *p, std::size_t ) noexcept{
+                std::free(p);
+            }
+
+            template <typename U>
+            bool operator==( const aligned_allocator<U, Alignment, HugePageBytes> & ) const noexcept{
+                return true;
+            }
+            template <typename U>
+            bool operator!=( const aligned_allocator<U, Alignment, HugePageBytes> & ) const noexcept{
+                return false;
+            }
+        };
+
+        /**
+        * @brief sc::vector com o bloco alinhado a uma linha de cache (64 bytes).
+        */
+        template <typename T, typename GrowthPolicy = growth::default_policy>
+        using aligned_vector = vector<T, aligned_allocator<T>, GrowthPolicy>;
+
+        /**
+        * @brief sc::vector para dados enormes: blocos alinhados a 2 MB, servidos por páginas enormes transparentes, com
+        * capacidade arredondada para páginas enormes inteiras.
+        */
+        template <typename T>
+        using huge_vector = vector<T, aligned_allocator<T, 64, 2 * 1024 * 1024>, growth::huge_page_rounded>;
+    }
+
+#endif
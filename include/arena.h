@@ -0,0 +1,166 @@
+/**
+ * @file arena.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Arena (recurso de memória monotônico) em C++
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>              // std::size_t, std::max_align_t
+#include <cstdint>              // std::uintptr_t
+#include <memory_resource>      // std::pmr::memory_resource
+
+    namespace sc{
+        /**
+        * @brief Recurso de memória monotônico (compatível com std::pmr::memory_resource). Cada alocação apenas avança
+        * um ponteiro dentro do bloco atual; quando o bloco se esgota, outro maior é pedido ao recurso upstream.
+        * deallocate() não devolve memória (exceto quando desfaz a última alocação): tudo é liberado de uma vez
+        * em release() ou na destruição da arena. Ideal para vetores de vida curta criados dentro de uma requisição:
+        *
+        *     sc::arena scope;
+        *     sc::pmr::vector<int> v(&scope);
+        */
+        class arena : public std::pmr::memory_resource {
+
+        private :
+            /// Cabeçalho de cada bloco obtido do upstream; os dados vêm logo após ele.
+            struct chunk {
+                chunk *next;
+                std::size_t size;
+            };
+
+            std::pmr::memory_resource *m_upstream;
+            chunk *m_chunks; //!< Lista dos blocos obtidos do upstream (o mais recente primeiro).
+            char *m_current; //!< Próximo byte livre.
+            char *m_end; //!< Fim do bloco atual.
+            char *m_last; //!< Início da última alocação (para desfazê-la em deallocate).
+            char *m_initial; //!< Buffer inicial fornecido pelo usuário (não é liberado).
+            std::size_t m_initial_size;
+            std::size_t m_next_size; //!< Tamanho do próximo bloco pedido ao upstream.
+            std::size_t m_allocated; //!< Bytes entregues desde o último release().
+
+            /**
+            * @brief Pede ao upstream um bloco com pelo menos bytes livres, alinhados a alignment.
+            * @param bytes         Tamanho mínimo.
+            * @param alignment     Alinhamento mínimo.
+            */
+            void new_chunk( std::size_t bytes, std::size_t alignment ){
+                std::size_t size = m_next_size;
+                while(size < bytes + alignment + sizeof(chunk))
+                    size *= 2;
+                chunk *c = static_cast<chunk *>(m_upstream->allocate(size, alignof(std::max_align_t)));
+                c->next = m_chunks;
+                c->size = size;
+                m_chunks = c;
+                m_current = reinterpret_cast<char *>(c + 1);
+                m_end = reinterpret_cast<char *>(c) + size;
+                m_next_size = size * 2;
+            }
+            /**
+            * @brief Alinha p para cima, até um múltiplo de alignment.
+            * @param p             Endereço.
+            * @param alignment     Alinhamento (potência de 2).
+            */
+            static char * align_up( char *p, std::size_t alignment ){
+                auto address = reinterpret_cast<std::uintptr_t>(p);
+                return p + ((alignment - address % alignment) % alignment);
+            }
+
+        protected :
+            void * do_allocate( std::size_t bytes, std::size_t alignment ) override{
+                char *p = m_current == nullptr ? nullptr : align_up(m_current, alignment);
+                if(p == nullptr or p > m_end or bytes > static_cast<std::size_t>(m_end - p)){
+                    new_chunk(bytes, alignment);
+                    p = align_up(m_current, alignment);
+                }
+                m_last = p;
+                m_current = p + bytes;
+                m_allocated += bytes;
+                return p;
+            }
+            void do_deallocate( void *p, std::size_t bytes, std::size_t ) override{
+                // Monotônico: só a última alocação pode ser desfeita (ex.: um vetor temporário que cresceu e morreu).
+                if(p == m_last and static_cast<char *>(p) + bytes == m_current){
+                    m_current = m_last;
+                    m_allocated -= bytes;
+                }
+            }
+            bool do_is_equal( const std::pmr::memory_resource &other ) const noexcept override{
+                return this == &other;
+            }
+
+        public :
+            /**
+            * @brief Cria uma arena que pedirá blocos ao upstream, começando por initial_size bytes.
+            * @param initial_size     Tamanho do primeiro bloco.
+            * @param upstream         Recurso de onde vêm os blocos.
+            */
+            explicit arena( std::size_t initial_size = 4096,
+                            std::pmr::memory_resource *upstream = std::pmr::get_default_resource() )
+                : m_upstream(upstream)
+                , m_chunks(nullptr)
+                , m_current(nullptr)
+                , m_end(nullptr)
+                , m_last(nullptr)
+                , m_initial(nullptr)
+                , m_initial_size(0)
+                , m_next_size(initial_size < 2 * sizeof(chunk) ? 2 * sizeof(chunk) : initial_size)
+                , m_allocated(0)
+            { }
+            /**
+            * @brief Cria uma arena que usa primeiro o buffer dado (ex.: um array na pilha) e só depois o upstream.
+            * @param buffer       Buffer inicial; deve viver mais que a arena.
+            * @param size         Tamanho do buffer em bytes.
+            * @param upstream     Recurso de onde vêm os blocos seguintes.
+            */
+            arena( void *buffer, std::size_t size,
+                   std::pmr::memory_resource *upstream = std::pmr::get_default_resource() )
+                : arena(size, upstream)
+            {
+                m_initial = static_cast<char *>(buffer);
+                m_initial_size = size;
+                m_current = m_initial;
+                m_end = m_initial + size;
+            }
+
+            arena( const arena & ) = delete;
+            arena& operator =( const arena & ) = delete;
+
+            /**
+            * @brief Destrói a arena, devolvendo todos os blocos ao upstream.
+            */
+            ~arena( void ) override{
+                release();
+            }
+            /**
+            * @brief Devolve todos os blocos ao upstream de uma vez. Tudo que foi alocado pela arena deixa de ser válido.
+            */
+            void release( void ){
+                while(m_chunks != nullptr){
+                    chunk *next = m_chunks->next;
+                    m_upstream->deallocate(m_chunks, m_chunks->size, alignof(std::max_align_t));
+                    m_chunks = next;
+                }
+                m_current = m_initial;
+                m_end = m_initial == nullptr ? nullptr : m_initial + m_initial_size;
+                m_last = nullptr;
+                m_allocated = 0;
+            }
+            /**
+            * @brief Retorna quantos bytes foram entregues desde a criação ou o último release().
+            */
+            std::size_t bytes_allocated( void ) const{
+                return m_allocated;
+            }
+            /**
+            * @brief Retorna o recurso de onde vêm os blocos.
+            */
+            std::pmr::memory_resource * upstream_resource( void ) const{
+                return m_upstream;
+            }
+        };
+    }
+
+#endif
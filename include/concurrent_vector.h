@@ -0,0 +1,303 @@
+/**
+ * @file concurrent_vector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Concurrent Vector (lista segmentada com inserção concorrente sem trava) em C++
+*/
+
+#ifndef CONCURRENT_VECTOR_H
+#define CONCURRENT_VECTOR_H
+
+#include <algorithm>            // std::min
+#include <atomic>               // std::atomic
+#include <memory>               // std::unique_ptr, std::allocator_traits
+#include <stdexcept>            // std::out_of_range
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Lista em que várias threads podem chamar push_back/emplace_back ao mesmo tempo, sem trava: cada
+        * inserção reserva um índice com um único fetch_add e constrói o elemento nele. Os elementos ficam em segmentos
+        * de tamanho crescente (First, 2*First, 4*First, ...) que nunca são realocados, de modo que referências e
+        * leituras por operator[] continuam válidas enquanto outras threads inserem.
+        *
+        * Um elemento está publicado quando o push_back que o inseriu retornou; quem lê vec[i] precisa ter recebido
+        * o índice i dessa thread (por qualquer sincronização) ou observado is_published(i). clear(), to_vector(),
+        * cópia e destruição exigem que nenhuma inserção esteja em andamento.
+        * @tparam T           Tipo dos elementos.
+        * @tparam Allocator   Alocador dos segmentos (chamado de várias threads).
+        * @tparam First       Tamanho do primeiro segmento (potência de 2).
+        */
+        template <typename T, typename Allocator = std::allocator<T>, std::size_t First = 32 >
+        class concurrent_vector {
+            static_assert(First > 0 and (First & (First - 1)) == 0, "First must be a power of two");
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using value_type = T; //!< The value type.
+            using allocator_type = Allocator; //!< The allocator type.
+            using pointer = value_type*; //!< Pointer to a value stored in the container.
+            using reference = value_type&; //!< Reference to a value stored in the container.
+            using const_reference = const value_type&; //!< Const reference to a value stored in the container.
+
+        private :
+            using alloc_traits = std::allocator_traits<Allocator>;
+
+            /// Um bloco de elementos e, para cada posição, se ela contém um objeto construído.
+            struct segment {
+                pointer data;
+                std::unique_ptr<std::atomic<bool>[]> ready;
+            };
+
+            static constexpr unsigned first_bits = __builtin_ctzll(First); //!< log2(First).
+            static constexpr unsigned max_segments = 64 - first_bits;
+
+            std::atomic<size_type> m_size; //!< Índices já reservados.
+            std::atomic<segment *> m_segments[max_segments];
+            Allocator m_alloc;
+
+            /**
+            * @brief Retorna o segmento que guarda o índice i.
+            * @param i     Índice.
+            */
+            static unsigned segment_of( size_type i ){
+                return 63 - __builtin_clzll(i + First) - first_bits;
+            }
+            /**
+            * @brief Retorna a posição do índice i dentro do seu segmento.
+            * @param i     Índice.
+            */
+            static size_type offset_of( size_type i ){
+                size_type biased = i + First;
+                return biased - (size_type(1) << (63 - __builtin_clzll(biased)));
+            }
+            /**
+            * @brief Retorna a capacidade do segmento k.
+            * @param k     Índice do segmento.
+            */
+            static size_type segment_size( unsigned k ){
+                return size_type(First) << k;
+            }
+            /**
+            * @brief Retorna o segmento k, alocando-o se necessário. Se duas threads o alocarem ao mesmo tempo, só uma
+            * instala o seu (compare_exchange) e a outra devolve o próprio bloco.
+            * @param k     Índice do segmento.
+            */
+            segment * acquire_segment( unsigned k ){
+                segment *s = m_segments[k].load(std::memory_order_acquire);
+                if(s != nullptr)
+                    return s;
+                auto fresh = std::make_unique<segment>();
+                // ready primeiro: fresh o libera se allocate lançar exceção, mas não libera data.
+                fresh->ready.reset(new std::atomic<bool>[segment_size(k)]());
+                fresh->data = alloc_traits::allocate(m_alloc, segment_size(k));
+                if(m_segments[k].compare_exchange_strong(s, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+                    return fresh.release();
+                alloc_traits::deallocate(m_alloc, fresh->data, segment_size(k));
+                return s;
+            }
+            /**
+            * @brief Destrói os elementos e libera todos os segmentos.
+            */
+            void release( void ){
+                for(unsigned k = 0; k < max_segments; ++k){
+                    segment *s = m_segments[k].load(std::memory_order_acquire);
+                    if(s == nullptr)
+                        continue;
+                    for(size_type j = 0; j < segment_size(k); ++j){
+                        if(s->ready[j].load(std::memory_order_relaxed))
+                            alloc_traits::destroy(m_alloc, s->data + j);
+                    }
+                    alloc_traits::deallocate(m_alloc, s->data, segment_size(k));
+                    delete s;
+                    m_segments[k].store(nullptr, std::memory_order_relaxed);
+                }
+                m_size.store(0, std::memory_order_relaxed);
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia, sem alocar.
+            */
+            concurrent_vector( void )
+                : concurrent_vector(Allocator())
+            { }
+            /**
+            * @brief Cria uma lista vazia que usará o alocador dado.
+            * @param alloc     Alocador.
+            */
+            explicit concurrent_vector( const Allocator &alloc )
+                : m_size(0)
+                , m_alloc(alloc)
+            {
+                for(auto &s : m_segments)
+                    s.store(nullptr, std::memory_order_relaxed);
+            }
+            /**
+            * @brief Um construtor de cópia (other não pode estar recebendo inserções).
+            * @param other      Onde será copiada a lista.
+            */
+            concurrent_vector( const concurrent_vector &other )
+                : concurrent_vector(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+            {
+                size_type n = other.size();
+                for(size_type i = 0; i < n; ++i){
+                    if(other.is_published(i))
+                        push_back(other[i]);
+                }
+            }
+
+            concurrent_vector& operator =( const concurrent_vector & ) = delete;
+
+            /**
+            * @brief Destrói a lista.
+            */
+            ~concurrent_vector( void ){
+                release();
+            }
+            /**
+            * @brief Retorna a quantidade de índices reservados, incluindo elementos ainda em construção por outras threads.
+            */
+            size_type size( void ) const{
+                return m_size.load(std::memory_order_acquire);
+            }
+            /**
+            * @brief Retorna true se nenhum elemento foi inserido.
+            */
+            bool empty( void ) const{
+                return size() == 0;
+            }
+            /**
+            * @brief Retorna quantos elementos cabem nos segmentos já alocados a partir do índice 0.
+            */
+            size_type capacity( void ) const{
+                size_type total = 0;
+                for(unsigned k = 0; k < max_segments and m_segments[k].load(std::memory_order_acquire) != nullptr; ++k)
+                    total += segment_size(k);
+                return total;
+            }
+            /**
+            * @brief Aloca os segmentos necessários para n elementos. Pode ser chamada junto com inserções.
+            * @param n     Capacidade desejada.
+            */
+            void reserve( size_type n ){
+                if(n == 0)
+                    return;
+                for(unsigned k = 0; k <= segment_of(n - 1); ++k)
+                    acquire_segment(k);
+            }
+            /**
+            * @brief Constrói um elemento a partir dos argumentos num índice novo e retorna esse índice. Segura para
+            * várias threads ao mesmo tempo. Se o construtor lançar exceção, o índice fica vazio (ver is_published).
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            size_type emplace_back( Args&&... args ){
+                size_type i = m_size.fetch_add(1, std::memory_order_relaxed);
+                segment *s = acquire_segment(segment_of(i));
+                size_type j = offset_of(i);
+                alloc_traits::construct(m_alloc, s->data + j, std::forward<Args>(args)...);
+                s->ready[j].store(true, std::memory_order_release);
+                return i;
+            }
+            /**
+            * @brief Adiciona uma cópia de value ao final e retorna seu índice. Segura para várias threads ao mesmo tempo.
+            * @param value     Valor a ser adicionado.
+            */
+            size_type push_back( const_reference value ){
+                return emplace_back(value);
+            }
+            /**
+            * @brief Move value para o final e retorna seu índice. Segura para várias threads ao mesmo tempo.
+            * @param value     Valor a ser movido.
+            */
+            size_type push_back( value_type &&value ){
+                return emplace_back(std::move(value));
+            }
+            /**
+            * @brief Retorna true se o elemento do índice i já foi construído. Permite a quem não recebeu o índice de
+            * um push_back esperar por ele (o acesso a vec[i] depois de true é seguro).
+            * @param i     Índice.
+            */
+            bool is_published( size_type i ) const{
+                if(i >= size())
+                    return false;
+                segment *s = m_segments[segment_of(i)].load(std::memory_order_acquire);
+                return s != nullptr and s->ready[offset_of(i)].load(std::memory_order_acquire);
+            }
+            /**
+            * @brief Retorna o elemento publicado no índice i, sem verificação.
+            * @param i     Índice.
+            */
+            reference operator []( size_type i ){
+                return m_segments[segment_of(i)].load(std::memory_order_acquire)->data[offset_of(i)];
+            }
+            /**
+            * @brief Retorna o elemento publicado no índice i, sem verificação.
+            * @param i     Índice.
+            */
+            const_reference operator []( size_type i ) const{
+                return m_segments[segment_of(i)].load(std::memory_order_acquire)->data[offset_of(i)];
+            }
+            /**
+            * @brief Retorna o elemento do índice i. Se ele não estiver publicado, uma exceção do tipo std::out_of_range é lançada.
+            * @param i     Índice.
+            */
+            reference at( size_type i ){
+                if(not is_published(i))
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return (*this)[i];
+            }
+            /**
+            * @brief Retorna o elemento do índice i. Se ele não estiver publicado, uma exceção do tipo std::out_of_range é lançada.
+            * @param i     Índice.
+            */
+            const_reference at( size_type i ) const{
+                if(not is_published(i))
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return (*this)[i];
+            }
+            /**
+            * @brief Remove todos os elementos e libera os segmentos. Não pode ser chamada junto com inserções.
+            */
+            void clear( void ){
+                release();
+            }
+            /**
+            * @brief Copia os elementos, em ordem de índice, para um sc::vector contíguo (índices vazios por exceção são pulados).
+            * Não pode ser chamada junto com inserções.
+            */
+            vector<T, Allocator> to_vector( void ) const{
+                size_type n = size();
+                vector<T, Allocator> result(n, m_alloc);
+                // Segmento a segmento: cada um é contíguo.
+                for(unsigned k = 0; k < max_segments; ++k){
+                    size_type first = (size_type(First) << k) - First;
+                    if(first >= n)
+                        break;
+                    const segment *s = m_segments[k].load(std::memory_order_acquire);
+                    if(s == nullptr)
+                        continue;
+                    size_type count = std::min(segment_size(k), n - first);
+                    size_type j = 0;
+                    while(j < count){
+                        size_type run = j;
+                        while(run < count and s->ready[run].load(std::memory_order_acquire))
+                            ++run;
+                        result.insert(result.cend(), s->data + j, s->data + run);
+                        j = run + 1;
+                    }
+                }
+                return result;
+            }
+            /**
+            * @brief Retorna o alocador.
+            */
+            allocator_type get_allocator( void ) const{
+                return m_alloc;
+            }
+        };
+    }
+
+#endif
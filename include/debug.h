@@ -0,0 +1,53 @@
+/**
+ * @file debug.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Modo de depuração (SC_VECTOR_DEBUG): verificação de limites e de iteradores invalidados
+*/
+
+#ifndef DEBUG_H
+#define DEBUG_H
+
+/**
+* Com SC_VECTOR_DEBUG definida (no programa inteiro, pois o modo muda o tamanho de MyIterator), sc::vector verifica
+* os limites de operator[], front, back, pop_back e pop_front, e cada iterador guarda a geração da lista que o criou:
+* usar um iterador depois que a lista realocou, foi esvaziada por clear() ou destruída encerra o programa com uma
+* mensagem. Sem a macro, as verificações não existem e MyIterator é apenas um ponteiro.
+*/
+#ifdef SC_VECTOR_DEBUG
+
+#include <cstdio>               // std::fprintf
+#include <cstdlib>              // std::abort
+#include <memory>               // std::shared_ptr
+#include <utility>              // std::move
+
+    namespace sc{
+        namespace debug{
+            /**
+            * @brief Estado compartilhado entre uma lista e seus iteradores. generation muda sempre que os iteradores
+            * existentes deixam de ser válidos.
+            */
+            struct state {
+                unsigned long generation = 0;
+            };
+
+            /**
+            * @brief Escreve a mensagem em stderr e encerra o programa.
+            * @param what     Descrição do erro.
+            */
+            [[noreturn]] inline void fail( const char *what ){
+                std::fprintf(stderr, "sc::vector debug check failed: %s\n", what);
+                std::abort();
+            }
+        }
+    }
+
+#define SC_DEBUG_CHECK(condition, message) ((condition) ? (void) 0 : ::sc::debug::fail(message))
+
+#else
+
+#define SC_DEBUG_CHECK(condition, message) ((void) 0)
+
+#endif
+
+#endif
@@ -0,0 +1,493 @@
+/**
+ * @file devector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Devector (lista contígua com reserva nas duas pontas) em C++
+*/
+
+#ifndef DEVECTOR_H
+#define DEVECTOR_H
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Lista contígua que mantém capacidade livre antes do primeiro elemento, além da capacidade livre após o último.
+        * Assim, push_front/pop_front custam O(1) amortizado (em sc::vector custam O(n)), mantendo data() e operator[] contíguos.
+        * Indicada para janelas deslizantes e filas.
+        */
+        template <typename T, typename Allocator = std::allocator<T> >
+        class devector {
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using value_type = T; //!< The value type.
+            using allocator_type = Allocator; //!< The allocator type.
+            using pointer = value_type*; //!< Pointer to a value stored in the container.
+            using reference = value_type&; //!< Reference to a value stored in the container.
+            using const_reference = const value_type&; //!< Const reference to a value stored in the container.
+            using iterator = MyIterator< T >; // See Code 3
+            using const_iterator = MyIterator< const T >; // See Code 3
+
+        private :
+            using alloc_traits = std::allocator_traits<Allocator>;
+
+            size_type m_begin; //!< Índice do primeiro elemento dentro do bloco.
+            size_type m_end; //!< Índice logo após o último elemento dentro do bloco.
+            size_type m_capacity;
+            pointer m_storage; //!< Memória bruta: apenas [m_begin, m_end) contém objetos construídos.
+            Allocator m_alloc;
+
+            /**
+            * @brief Move os elementos para um bloco novo de new_cap posições, deixando o primeiro elemento no índice new_begin, e libera o bloco antigo.
+            * @param new_cap       Nova capacidade do armazenamento.
+            * @param new_begin     Posição do primeiro elemento no bloco novo.
+            */
+            void reallocate( size_type new_cap, size_type new_begin ){
+                pointer new_storage = alloc_traits::allocate(m_alloc, new_cap);
+                try {
+                    detail::relocate(m_alloc, m_storage + m_begin, size(), new_storage + new_begin);
+                } catch(...) {
+                    alloc_traits::deallocate(m_alloc, new_storage, new_cap);
+                    throw;
+                }
+                if(m_storage != nullptr)
+                    alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+                m_end = new_begin + size();
+                m_begin = new_begin;
+                m_storage = new_storage;
+                m_capacity = new_cap;
+            }
+            /**
+            * @brief Garante uma posição livre antes do primeiro elemento. Se a lista ocupa menos da metade do bloco, apenas recentraliza; caso contrário, dobra a capacidade. Em ambos os casos a folga é dividida entre as duas pontas, o que mantém o custo amortizado O(1).
+            */
+            void make_room_front( void ){
+                size_type new_cap = size() < m_capacity / 2 ? m_capacity : next_capacity();
+                size_type spare = new_cap - size();
+                reallocate(new_cap, spare - spare / 2);
+            }
+            /**
+            * @brief Garante uma posição livre após o último elemento, com a mesma regra de make_room_front().
+            */
+            void make_room_back( void ){
+                size_type new_cap = size() < m_capacity / 2 ? m_capacity : next_capacity();
+                size_type spare = new_cap - size();
+                reallocate(new_cap, spare / 2);
+            }
+            /**
+            * @brief Retorna a capacidade usada no próximo crescimento: o dobro da atual (partindo de 2 quando vazia, uma posição para cada ponta).
+            */
+            size_type next_capacity( void ) const{
+                return m_capacity == 0 ? 2 : m_capacity * 2;
+            }
+
+            /**
+            * @brief Destrói os elementos e libera o bloco, deixando a lista vazia e sem capacidade.
+            */
+            void release( void ){
+                clear();
+                if(m_storage != nullptr)
+                    alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+                m_begin = m_end = m_capacity = 0;
+                m_storage = nullptr;
+            }
+            /**
+            * @brief Esvazia a lista e garante um bloco com n posições livres a partir de m_begin, com a folga dividida entre as pontas. Se for preciso um bloco novo, ele tem exatamente n posições.
+            * @param n     Quantidade de elementos que serão construídos.
+            */
+            void make_empty_room( size_type n ){
+                clear();
+                if(n > m_capacity){
+                    pointer new_storage = alloc_traits::allocate(m_alloc, n);
+                    if(m_storage != nullptr)
+                        alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+                    m_storage = new_storage;
+                    m_capacity = n;
+                }
+                m_begin = m_end = (m_capacity - n) / 2;
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia. Nenhuma memória é alocada.
+            */
+            devector()
+                : m_begin(0)
+                , m_end(0)
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc()
+            { }
+            /**
+            * @brief Cria uma lista vazia que usa o alocador dado.
+            * @param alloc     Alocador.
+            */
+            explicit devector( const Allocator &alloc )
+                : m_begin(0)
+                , m_end(0)
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc(alloc)
+            { }
+            /**
+            * @brief Constrói a lista com o conteúdo da lista de inicializadores, sem folga nas pontas.
+            * @param list     Lista de inicializadores.
+            * @param alloc    Alocador.
+            */
+            devector( std::initializer_list<T> list, const Allocator &alloc = Allocator() )
+                : devector(alloc)
+            {
+                if(list.size() == 0)
+                    return;
+                m_storage = alloc_traits::allocate(m_alloc, list.size());
+                m_capacity = list.size();
+                try {
+                    detail::construct_range(m_alloc, list.begin(), list.end(), m_storage);
+                } catch(...) {
+                    alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+                    throw;
+                }
+                m_end = list.size();
+            }
+            /**
+            * @brief Um construtor de cópia. A cópia não tem folga nas pontas.
+            * @param other      Onde será copiada a lista.
+            */
+            devector( const devector &other )
+                : devector(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+            {
+                if(other.empty())
+                    return;
+                m_storage = alloc_traits::allocate(m_alloc, other.size());
+                m_capacity = other.size();
+                try {
+                    detail::construct_range(m_alloc, other.m_storage + other.m_begin, other.m_storage + other.m_end, m_storage);
+                } catch(...) {
+                    alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+                    throw;
+                }
+                m_end = other.size();
+            }
+            /**
+            * @brief Um construtor de movimento. Toma posse do armazenamento de other em O(1).
+            * @param other      Lista cujo armazenamento será tomado.
+            */
+            devector( devector &&other ) noexcept
+                : devector(std::move(other.m_alloc))
+            {
+                swap(other);
+            }
+            /**
+            * @brief Destrói a lista, chamando os destruidores dos elementos e liberando o armazenamento.
+            */
+            ~devector( void ){
+                clear();
+                if(m_storage != nullptr)
+                    alloc_traits::deallocate(m_alloc, m_storage, m_capacity);
+            }
+            /**
+            * @brief Copiar operador de atribuição. Substitui o conteúdo por uma cópia do conteúdo de other; o alocador de other só é copiado se propagate_on_container_copy_assignment permitir.
+            * @param other     O que será copiado
+            */
+            devector& operator =( const devector &other ){
+                if(this == &other)
+                    return *this;
+
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value){
+                    if(m_alloc != other.m_alloc)
+                        release(); // o bloco atual só pode ser liberado pelo alocador antigo
+                    m_alloc = other.m_alloc;
+                }
+                make_empty_room(other.size());
+                detail::construct_range(m_alloc, other.m_storage + other.m_begin, other.m_storage + other.m_end, m_storage + m_begin);
+                m_end = m_begin + other.size();
+                return *this;
+            }
+            /**
+            * @brief Operador de atribuição por movimento. Toma posse do armazenamento de other em O(1), deixando-o vazio e sem capacidade. Se o alocador não se propaga e os alocadores diferem, os elementos são movidos um a um para um bloco deste alocador.
+            * @param other     O que será movido
+            */
+            devector& operator =( devector &&other ) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                                                              or alloc_traits::is_always_equal::value){
+                if(this == &other)
+                    return *this;
+
+                if constexpr (not alloc_traits::propagate_on_container_move_assignment::value
+                              and not alloc_traits::is_always_equal::value){
+                    if(m_alloc != other.m_alloc){
+                        make_empty_room(other.size());
+                        detail::relocate(m_alloc, other.m_storage + other.m_begin, other.size(), m_storage + m_begin);
+                        m_end = m_begin + other.size();
+                        other.m_end = other.m_begin;
+                        return *this;
+                    }
+                }
+                release();
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                    m_alloc = std::move(other.m_alloc);
+                swap(other);
+                return *this;
+            }
+            /**
+            * @brief Retorna uma cópia do alocador associado à lista.
+            */
+            allocator_type get_allocator( void ) const{
+                return m_alloc;
+            }
+            /**
+            * @brief Troca o conteúdo com o de other em O(1). Se o alocador não se propaga na troca, os alocadores das duas listas devem ser iguais.
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap( devector &other ) noexcept{
+                using std::swap;
+                if constexpr (alloc_traits::propagate_on_container_swap::value)
+                    swap(m_alloc, other.m_alloc);
+                swap(m_begin, other.m_begin);
+                swap(m_end, other.m_end);
+                swap(m_capacity, other.m_capacity);
+                swap(m_storage, other.m_storage);
+            }
+
+            /**
+            * @brief Retorna o número de elementos no container.
+            */
+            size_type size( void ) const{
+                return m_end - m_begin;
+            }
+            /**
+            * @brief Retorna a capacidade total do bloco (folga da frente + elementos + folga de trás).
+            */
+            size_type capacity( void ) const{
+                return m_capacity;
+            }
+            /**
+            * @brief Retorna quantos push_front cabem antes de uma realocação.
+            */
+            size_type front_free( void ) const{
+                return m_begin;
+            }
+            /**
+            * @brief Retorna quantos push_back cabem antes de uma realocação.
+            */
+            size_type back_free( void ) const{
+                return m_capacity - m_end;
+            }
+            /**
+            * @brief Retorna true se o container não contiver nenhum elemento, e false caso contrário.
+            */
+            bool empty( void ) const{
+                return m_begin == m_end;
+            }
+            /**
+            * @brief Remove todos os elementos do container, chamando seus destruidores. A capacidade não é alterada e a folga volta a ser dividida entre as pontas.
+            */
+            void clear( void ){
+                detail::destroy(m_alloc, m_storage + m_begin, m_storage + m_end);
+                m_begin = m_end = m_capacity / 2;
+            }
+            /**
+            * @brief Garante capacidade para new_cap elementos, dividindo a folga entre as duas pontas.
+            * @param new_cap     Novo valor da capacidade de armazenamento.
+            */
+            void reserve( size_type new_cap ){
+                if(new_cap > m_capacity){
+                    size_type spare = new_cap - size();
+                    reallocate(new_cap, spare / 2);
+                }
+            }
+
+            /**
+            * @brief Constrói um valor no inicio da lista a partir dos argumentos dados, em O(1) amortizado.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            reference emplace_front( Args&&... args ){
+                if(m_begin == 0){
+                    value_type value(std::forward<Args>(args)...); // args podem referenciar o bloco liberado
+                    make_room_front();
+                    alloc_traits::construct(m_alloc, m_storage + m_begin - 1, std::move(value));
+                } else
+                    alloc_traits::construct(m_alloc, m_storage + m_begin - 1, std::forward<Args>(args)...);
+                return m_storage[--m_begin];
+            }
+            /**
+            * @brief Constrói um valor no final da lista a partir dos argumentos dados, em O(1) amortizado.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            reference emplace_back( Args&&... args ){
+                if(m_end == m_capacity){
+                    value_type value(std::forward<Args>(args)...); // args podem referenciar o bloco liberado
+                    make_room_back();
+                    alloc_traits::construct(m_alloc, m_storage + m_end, std::move(value));
+                } else
+                    alloc_traits::construct(m_alloc, m_storage + m_end, std::forward<Args>(args)...);
+                return m_storage[m_end++];
+            }
+            /**
+            * @brief Adiciona um valor no inicio da lista, em O(1) amortizado.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_front( const_reference value ){
+                emplace_front(value);
+            }
+            /**
+            * @brief Adiciona um valor no inicio da lista, movendo-o.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_front( value_type &&value ){
+                emplace_front(std::move(value));
+            }
+            /**
+            * @brief Adiciona um valor ao final da lista, em O(1) amortizado.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_back( const_reference value ){
+                emplace_back(value);
+            }
+            /**
+            * @brief Adiciona um valor ao final da lista, movendo-o.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_back( value_type &&value ){
+                emplace_back(std::move(value));
+            }
+            /**
+            * @brief Remove o objeto no inicio da lista em O(1); a posição liberada passa a ser folga da frente.
+            */
+            void pop_front( void ){
+                alloc_traits::destroy(m_alloc, m_storage + m_begin);
+                m_begin++;
+            }
+            /**
+            * @brief Remove o objeto no final da lista em O(1).
+            */
+            void pop_back( void ){
+                m_end--;
+                alloc_traits::destroy(m_alloc, m_storage + m_end);
+            }
+
+            /**
+            * @brief Retorna o objeto no inicio da lista.
+            */
+            reference front( void ){
+                return m_storage[m_begin];
+            }
+            /**
+            * @brief Retorna o objeto no inicio da lista.
+            */
+            const_reference front( void ) const{
+                return m_storage[m_begin];
+            }
+            /**
+            * @brief Retorna o objeto no final da lista.
+            */
+            reference back( void ){
+                return m_storage[m_end-1];
+            }
+            /**
+            * @brief Retorna o objeto no final da lista.
+            */
+            const_reference back( void ) const{
+                return m_storage[m_end-1];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, sem verificação de limites.
+            * @param pos     Posição do indice.
+            */
+            reference operator[]( size_type pos ){
+                return m_storage[m_begin + pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, sem verificação de limites.
+            * @param pos     Posição do indice.
+            */
+            const_reference operator[]( size_type pos ) const{
+                return m_storage[m_begin + pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, com verificação de limites. Se pos não estiver dentro do intervalo da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição do indice.
+            */
+            reference at( size_type pos ){
+                if(pos >= size())
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return m_storage[m_begin + pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, com verificação de limites. Se pos não estiver dentro do intervalo da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição do indice.
+            */
+            const_reference at( size_type pos ) const{
+                if(pos >= size())
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return m_storage[m_begin + pos];
+            }
+            /**
+            * @brief Retorna um ponteiro para o primeiro elemento; os size() elementos são contíguos a partir dele.
+            */
+            pointer data( void ){
+                return m_storage + m_begin;
+            }
+            /**
+            * @brief Retorna um ponteiro constante para o primeiro elemento.
+            */
+            const value_type * data( void ) const{
+                return m_storage + m_begin;
+            }
+
+            /**
+            * @brief Retorna um iterador apontando para o primeiro item da lista.
+            */
+            iterator begin( void ){
+                return iterator( m_storage + m_begin );
+            }
+            /**
+            * @brief Retorna um iterador apontando para a posição logo após o último elemento da lista.
+            */
+            iterator end( void ){
+                return iterator( m_storage + m_end );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para o primeiro item na lista.
+            */
+            const_iterator begin( void ) const{
+                return const_iterator( m_storage + m_begin );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para a posição logo após o último elemento da lista.
+            */
+            const_iterator end( void ) const{
+                return const_iterator( m_storage + m_end );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para o primeiro item na lista.
+            */
+            const_iterator cbegin( void ) const{
+                return const_iterator( m_storage + m_begin );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para a posição logo após o último elemento da lista.
+            */
+            const_iterator cend( void ) const{
+                return const_iterator( m_storage + m_end );
+            }
+
+            /**
+            * @brief Verifica se o conteúdo de rhs é igual ao desta lista.
+            * @param rhs     Lista.
+            */
+            bool operator==( const devector &rhs ) const{
+                return size() == rhs.size() and std::equal(data(), data() + size(), rhs.data());
+            }
+            /**
+            * @brief Verifica se o conteúdo de rhs é diferente do desta lista.
+            * @param rhs     Lista.
+            */
+            bool operator!=( const devector &rhs ) const{
+                return not (*this == rhs);
+            }
+        };
+    }
+
+#endif
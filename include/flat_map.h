@@ -0,0 +1,465 @@
+/**
+ * @file flat_map.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Flat Map (mapa ordenado sobre dois sc::vector) em C++
+*/
+
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <algorithm>            // std::stable_sort
+#include <cstddef>              // std::ptrdiff_t
+#include <functional>           // std::less
+#include <iterator>             // std::random_access_iterator_tag
+#include <stdexcept>            // std::out_of_range
+#include <type_traits>          // std::enable_if, std::is_convertible
+#include <utility>              // std::pair, std::move, std::forward
+
+#include "flat_set.h"           // detail::branchless_lower_bound
+#include "span.h"
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Mapa ordenado com chaves únicas guardado em dois sc::vector paralelos: um só com as chaves, outro só
+        * com os valores. A busca binária (sem desvios, ver detail::branchless_lower_bound) percorre apenas o array de
+        * chaves, que fica denso na cache mesmo quando os valores são grandes. Inserções e remoções isoladas custam O(n);
+        * para carregar muitos pares use insert(first, last), que ordena os novos pares e os intercala uma única vez.
+        *
+        * Os iteradores devolvem std::pair<const Key&, T&> por valor (não há um par guardado na memória), de modo que
+        * `for(auto [k, v] : map)` e `it->second` funcionam, mas `auto &p = *it` não.
+        * @tparam Key        Tipo das chaves.
+        * @tparam T          Tipo dos valores.
+        * @tparam Compare    Ordem das chaves.
+        */
+        template <typename Key, typename T, typename Compare = std::less<Key> >
+        class flat_map {
+
+        public :
+            /**
+            * @brief Iterador de acesso aleatório sobre os pares (chave, valor), que anda nos dois arrays ao mesmo tempo.
+            * @tparam V     T ou const T.
+            */
+            template <typename V>
+            class basic_iterator {
+                friend class flat_map;
+
+                const Key *m_key;
+                V *m_value;
+
+                basic_iterator( const Key *key, V *value )
+                    : m_key(key)
+                    , m_value(value)
+                { }
+
+            public :
+                using iterator_category = std::random_access_iterator_tag; //!< Iterator category.
+                using difference_type = std::ptrdiff_t; //!< Difference type.
+                using value_type = std::pair<Key, T>; //!< Value type.
+                using reference = std::pair<const Key&, V&>; //!< Reference proxy, returned by value.
+
+                /**
+                * @brief Guarda o par retornado por operator-> enquanto a expressão é avaliada.
+                */
+                struct pointer {
+                    reference ref;
+                    reference * operator->( void ){
+                        return &ref;
+                    }
+                };
+
+                basic_iterator( void )
+                    : m_key(nullptr)
+                    , m_value(nullptr)
+                { }
+                /**
+                * @brief Converte um iterator num const_iterator.
+                */
+                template <typename U, typename = typename std::enable_if<std::is_convertible<U*, V*>::value>::type >
+                basic_iterator( const basic_iterator<U> &other )
+                    : m_key(other.key_ptr())
+                    , m_value(other.value_ptr())
+                { }
+
+                const Key * key_ptr( void ) const{ return m_key; }
+                V * value_ptr( void ) const{ return m_value; }
+
+                reference operator*( void ) const{
+                    return reference(*m_key, *m_value);
+                }
+                pointer operator->( void ) const{
+                    return pointer{ **this };
+                }
+                reference operator[]( difference_type n ) const{
+                    return reference(m_key[n], m_value[n]);
+                }
+                basic_iterator & operator++( void ){
+                    ++m_key;
+                    ++m_value;
+                    return *this;
+                }
+                basic_iterator operator++( int ){
+                    basic_iterator old(*this);
+                    ++*this;
+                    return old;
+                }
+                basic_iterator & operator--( void ){
+                    --m_key;
+                    --m_value;
+                    return *this;
+                }
+                basic_iterator operator--( int ){
+                    basic_iterator old(*this);
+                    --*this;
+                    return old;
+                }
+                basic_iterator & operator+=( difference_type n ){
+                    m_key += n;
+                    m_value += n;
+                    return *this;
+                }
+                basic_iterator & operator-=( difference_type n ){
+                    return *this += -n;
+                }
+                basic_iterator operator+( difference_type n ) const{
+                    return basic_iterator(m_key + n, m_value + n);
+                }
+                basic_iterator operator-( difference_type n ) const{
+                    return basic_iterator(m_key - n, m_value - n);
+                }
+                difference_type operator-( const basic_iterator &other ) const{
+                    return m_key - other.m_key;
+                }
+                bool operator==( const basic_iterator &other ) const{ return m_key == other.m_key; }
+                bool operator!=( const basic_iterator &other ) const{ return m_key != other.m_key; }
+                bool operator<( const basic_iterator &other ) const{ return m_key < other.m_key; }
+                bool operator>( const basic_iterator &other ) const{ return m_key > other.m_key; }
+                bool operator<=( const basic_iterator &other ) const{ return m_key <= other.m_key; }
+                bool operator>=( const basic_iterator &other ) const{ return m_key >= other.m_key; }
+            };
+
+            using size_type = unsigned long; //!< The size type.
+            using key_type = Key; //!< The key type.
+            using mapped_type = T; //!< The mapped type.
+            using value_type = std::pair<Key, T>; //!< The value type.
+            using key_compare = Compare; //!< The key ordering.
+            using iterator = basic_iterator<T>; //!< Iterator over (key, value) pairs, in key order.
+            using const_iterator = basic_iterator<const T>; //!< Const iterator over (key, value) pairs.
+
+        private :
+            vector<Key> m_keys; //!< Chaves, ordenadas e sem repetições.
+            vector<T> m_values; //!< m_values[i] é o valor de m_keys[i].
+            Compare m_comp;
+
+            /**
+            * @brief Índice da primeira chave que não é menor que key.
+            * @param key     Chave procurada.
+            */
+            size_type lower_index( const Key &key ) const{
+                return detail::branchless_lower_bound(m_keys.data(), m_keys.size(), key, const_cast<Compare &>(m_comp));
+            }
+            /**
+            * @brief Índice da chave equivalente a key, ou size() se não houver.
+            * @param key     Chave procurada.
+            */
+            size_type find_index( const Key &key ) const{
+                size_type i = lower_index(key);
+                return i != size() and not m_comp(key, m_keys[i]) ? i : size();
+            }
+            iterator iterator_at( size_type i ){
+                return iterator(m_keys.data() + i, m_values.data() + i);
+            }
+            const_iterator iterator_at( size_type i ) const{
+                return const_iterator(m_keys.data() + i, m_values.data() + i);
+            }
+            /**
+            * @brief Insere o par (key, T(args...)) na posição i, que deve ser a posição ordenada de key.
+            */
+            template <typename K, typename... Args>
+            iterator insert_at( size_type i, K &&key, Args&&... args ){
+                m_values.emplace(m_values.cbegin() + i, std::forward<Args>(args)...);
+                try{
+                    m_keys.emplace(m_keys.cbegin() + i, std::forward<K>(key));
+                }catch(...){
+                    m_values.erase(m_values.cbegin() + i);
+                    throw;
+                }
+                return iterator_at(i);
+            }
+
+        public :
+            /**
+            * @brief Cria um mapa vazio.
+            * @param comp     Ordem das chaves.
+            */
+            explicit flat_map( const Compare &comp = Compare() )
+                : m_keys()
+                , m_values()
+                , m_comp(comp)
+            { }
+            /**
+            * @brief Cria um mapa com os pares do intervalo first-last. Entre chaves repetidas vale o primeiro par.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            * @param comp      Ordem das chaves.
+            */
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+            flat_map( InputIt first, InputIt last, const Compare &comp = Compare() )
+                : flat_map(comp)
+            {
+                insert(first, last);
+            }
+            /**
+            * @brief Cria um mapa com os pares da lista de inicializadores.
+            * @param list     Lista de inicializadores.
+            * @param comp     Ordem das chaves.
+            */
+            flat_map( std::initializer_list<value_type> list, const Compare &comp = Compare() )
+                : flat_map(list.begin(), list.end(), comp)
+            { }
+
+            /**
+            * @brief Retorna o número de pares.
+            */
+            size_type size( void ) const{
+                return m_keys.size();
+            }
+            /**
+            * @brief Retorna true se o mapa estiver vazio.
+            */
+            bool empty( void ) const{
+                return m_keys.empty();
+            }
+            /**
+            * @brief Remove todos os pares. A capacidade não é alterada.
+            */
+            void clear( void ){
+                m_keys.clear();
+                m_values.clear();
+            }
+            /**
+            * @brief Reserva espaço para n pares.
+            * @param n     Capacidade desejada.
+            */
+            void reserve( size_type n ){
+                m_keys.reserve(n);
+                m_values.reserve(n);
+            }
+            /**
+            * @brief Retorna as chaves, em ordem, como um span contíguo.
+            */
+            span<const Key> keys( void ) const{
+                return span<const Key>(m_keys);
+            }
+            /**
+            * @brief Retorna os valores, na ordem das chaves, como um span contíguo.
+            */
+            span<T> values( void ){
+                return span<T>(m_values);
+            }
+            /**
+            * @brief Retorna os valores, na ordem das chaves, como um span contíguo somente leitura.
+            */
+            span<const T> values( void ) const{
+                return span<const T>(m_values);
+            }
+
+            iterator begin( void ){ return iterator_at(0); }
+            iterator end( void ){ return iterator_at(size()); }
+            const_iterator begin( void ) const{ return iterator_at(0); }
+            const_iterator end( void ) const{ return iterator_at(size()); }
+            const_iterator cbegin( void ) const{ return begin(); }
+            const_iterator cend( void ) const{ return end(); }
+
+            /**
+            * @brief Retorna um iterador para o par da primeira chave que não é menor que key.
+            * @param key     Chave procurada.
+            */
+            iterator lower_bound( const Key &key ){
+                return iterator_at(lower_index(key));
+            }
+            const_iterator lower_bound( const Key &key ) const{
+                return iterator_at(lower_index(key));
+            }
+            /**
+            * @brief Retorna um iterador para o par com a chave key, ou end() se não houver.
+            * @param key     Chave procurada.
+            */
+            iterator find( const Key &key ){
+                return iterator_at(find_index(key));
+            }
+            const_iterator find( const Key &key ) const{
+                return iterator_at(find_index(key));
+            }
+            /**
+            * @brief Retorna true se o mapa contém key.
+            * @param key     Chave procurada.
+            */
+            bool contains( const Key &key ) const{
+                return find_index(key) != size();
+            }
+            /**
+            * @brief Retorna 1 se o mapa contém key, e 0 caso contrário.
+            * @param key     Chave procurada.
+            */
+            size_type count( const Key &key ) const{
+                return contains(key) ? 1 : 0;
+            }
+            /**
+            * @brief Retorna o valor da chave key. Lança std::out_of_range se ela não existir.
+            * @param key     Chave.
+            */
+            T & at( const Key &key ){
+                size_type i = find_index(key);
+                if(i == size())
+                    throw std::out_of_range("[at()] Key not found in flat_map");
+                return m_values[i];
+            }
+            const T & at( const Key &key ) const{
+                size_type i = find_index(key);
+                if(i == size())
+                    throw std::out_of_range("[at()] Key not found in flat_map");
+                return m_values[i];
+            }
+            /**
+            * @brief Retorna o valor da chave key, inserindo T() se ela não existir.
+            * @param key     Chave.
+            */
+            T & operator[]( const Key &key ){
+                return try_emplace(key).first->second;
+            }
+
+            /**
+            * @brief Insere (key, T(args...)) se key não existir. Retorna um iterador para o par da chave e true se ele
+            * foi inserido; se a chave já existia, nada é construído.
+            * @param key      Chave.
+            * @param args     Argumentos do construtor do valor.
+            */
+            template <typename... Args>
+            std::pair<iterator, bool> try_emplace( const Key &key, Args&&... args ){
+                size_type i = lower_index(key);
+                if(i != size() and not m_comp(key, m_keys[i]))
+                    return { iterator_at(i), false };
+                return { insert_at(i, key, std::forward<Args>(args)...), true };
+            }
+            /**
+            * @brief Insere o par se a chave não existir (como try_emplace).
+            * @param value     Par (chave, valor).
+            */
+            std::pair<iterator, bool> insert( const value_type &value ){
+                return try_emplace(value.first, value.second);
+            }
+            /**
+            * @brief Insere o par, ou troca o valor se a chave já existir. Retorna true se o par foi inserido.
+            * @param key       Chave.
+            * @param value     Valor.
+            */
+            template <typename M>
+            std::pair<iterator, bool> insert_or_assign( const Key &key, M &&value ){
+                size_type i = lower_index(key);
+                if(i != size() and not m_comp(key, m_keys[i])){
+                    m_values[i] = std::forward<M>(value);
+                    return { iterator_at(i), false };
+                }
+                return { insert_at(i, key, std::forward<M>(value)), true };
+            }
+            /**
+            * @brief Insere os pares do intervalo first-last de uma vez. Os novos pares são copiados para arrays
+            * temporários e ordenados por chave (estável), e então intercalados com os existentes num único passo que
+            * preenche arrays novos, em O(n + m log m). Chaves que já existem não são alteradas; entre chaves repetidas
+            * no intervalo vale o primeiro par.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+            void insert( InputIt first, InputIt last ){
+                vector<Key> new_keys;
+                vector<T> new_values;
+                for(; first != last; ++first){
+                    new_keys.emplace_back((*first).first);
+                    new_values.emplace_back((*first).second);
+                }
+                if(new_keys.empty())
+                    return;
+
+                vector<size_type> order;
+                order.reserve(new_keys.size());
+                for(size_type i = 0; i < new_keys.size(); ++i)
+                    order.push_back(i);
+                std::stable_sort(order.begin(), order.end(), [&]( size_type a, size_type b ){
+                    return m_comp(new_keys[a], new_keys[b]);
+                });
+
+                vector<Key> keys;
+                vector<T> values;
+                keys.reserve(size() + new_keys.size());
+                values.reserve(size() + new_keys.size());
+                size_type i = 0, j = 0;
+                while(i < size() or j < order.size()){
+                    bool take_old = j == order.size() or (i < size() and not m_comp(new_keys[order[j]], m_keys[i]));
+                    if(take_old){
+                        // Novas chaves equivalentes à antiga são descartadas.
+                        while(j < order.size() and not m_comp(m_keys[i], new_keys[order[j]]))
+                            ++j;
+                        keys.push_back(std::move(m_keys[i]));
+                        values.push_back(std::move(m_values[i]));
+                        ++i;
+                    }else{
+                        size_type k = order[j++];
+                        while(j < order.size() and not m_comp(new_keys[k], new_keys[order[j]]))
+                            ++j;
+                        keys.push_back(std::move(new_keys[k]));
+                        values.push_back(std::move(new_values[k]));
+                    }
+                }
+                m_keys = std::move(keys);
+                m_values = std::move(values);
+            }
+            /**
+            * @brief Insere os pares da lista de inicializadores de uma vez.
+            * @param list     Lista de inicializadores.
+            */
+            void insert( std::initializer_list<value_type> list ){
+                insert(list.begin(), list.end());
+            }
+            /**
+            * @brief Remove o par da chave key, se existir, e retorna quantos foram removidos (0 ou 1).
+            * @param key     Chave.
+            */
+            size_type erase( const Key &key ){
+                size_type i = find_index(key);
+                if(i == size())
+                    return 0;
+                erase(iterator_at(i));
+                return 1;
+            }
+            /**
+            * @brief Remove o par na posição it e retorna um iterador para o seguinte.
+            * @param it     Posição.
+            */
+            iterator erase( const_iterator it ){
+                size_type i = it.key_ptr() - m_keys.data();
+                m_keys.erase(m_keys.cbegin() + i);
+                m_values.erase(m_values.cbegin() + i);
+                return iterator_at(i);
+            }
+
+            /**
+            * @brief Verifica se os dois mapas têm os mesmos pares.
+            * @param other     Mapa.
+            */
+            bool operator==( const flat_map &other ) const{
+                return m_keys == other.m_keys and m_values == other.m_values;
+            }
+            /**
+            * @brief Verifica se os mapas têm pares diferentes.
+            * @param other     Mapa.
+            */
+            bool operator!=( const flat_map &other ) const{
+                return not (*this == other);
+            }
+        };
+    }
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * @file flat_set.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Flat Set (conjunto ordenado sobre sc::vector) em C++
+*/
+
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include <algorithm>            // std::stable_sort, std::inplace_merge, std::unique
+#include <cstddef>              // std::size_t
+#include <functional>           // std::less
+#include <iterator>             // std::iterator_traits
+#include <utility>              // std::pair
+
+#include "span.h"
+#include "vector.h"
+
+    namespace sc{
+        namespace detail{
+            /**
+            * @brief Retorna o índice do primeiro elemento de [first, first + n) que não é menor que key (como
+            * std::lower_bound). A busca não tem desvios dependentes dos dados: cada passo escolhe a metade com uma
+            * seleção (cmov), o que evita erros de previsão de desvio.
+            * @param first     Início do intervalo ordenado.
+            * @param n         Tamanho do intervalo.
+            * @param key       Chave procurada.
+            * @param comp      Comparação usada na ordenação.
+            */
+            template <typename T, typename K, typename Compare>
+            std::size_t branchless_lower_bound( const T *first, std::size_t n, const K &key, Compare &comp ){
+                if(n == 0)
+                    return 0;
+                const T *base = first;
+                while(n > 1){
+                    std::size_t half = n / 2;
+                    base = comp(base[half - 1], key) ? base + half : base;
+                    n -= half;
+                }
+                return (base - first) + (comp(*base, key) ? 1 : 0);
+            }
+        }
+
+        /**
+        * @brief Conjunto ordenado e sem repetições guardado num sc::vector contíguo. As buscas são binárias e sem
+        * desvios, e percorrer o conjunto é percorrer um array; inserções e remoções isoladas custam O(n) (deslocam a
+        * cauda com sc::vector::insert/erase), por isso muitas chaves devem ser inseridas de uma vez com
+        * insert(first, last), que as acrescenta ao final, ordena e intercala uma única vez.
+        * @tparam Key        Tipo das chaves.
+        * @tparam Compare    Ordem das chaves.
+        */
+        template <typename Key, typename Compare = std::less<Key> >
+        class flat_set {
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using key_type = Key; //!< The key type.
+            using value_type = Key; //!< The value type.
+            using key_compare = Compare; //!< The key ordering.
+            using const_reference = const Key&; //!< Const reference to a key.
+            using const_iterator = typename vector<Key>::const_iterator; //!< Iterator over the keys, in order.
+            using iterator = const_iterator; //!< Keys cannot be changed in place.
+
+        private :
+            vector<Key> m_keys; //!< Chaves, ordenadas e sem repetições.
+            Compare m_comp;
+
+            /**
+            * @brief Retorna true se a e b são equivalentes segundo a ordem.
+            */
+            bool equivalent( const Key &a, const Key &b ) const{
+                return not m_comp(a, b) and not m_comp(b, a);
+            }
+            /**
+            * @brief Índice da primeira chave que não é menor que key.
+            * @param key     Chave procurada.
+            */
+            size_type lower_index( const Key &key ) const{
+                return detail::branchless_lower_bound(m_keys.data(), m_keys.size(), key, const_cast<Compare &>(m_comp));
+            }
+
+        public :
+            /**
+            * @brief Cria um conjunto vazio.
+            * @param comp     Ordem das chaves.
+            */
+            explicit flat_set( const Compare &comp = Compare() )
+                : m_keys()
+                , m_comp(comp)
+            { }
+            /**
+            * @brief Cria um conjunto com as chaves do intervalo first-last (em qualquer ordem, com repetições).
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            * @param comp      Ordem das chaves.
+            */
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+            flat_set( InputIt first, InputIt last, const Compare &comp = Compare() )
+                : flat_set(comp)
+            {
+                insert(first, last);
+            }
+            /**
+            * @brief Cria um conjunto com as chaves da lista de inicializadores.
+            * @param list     Lista de inicializadores.
+            * @param comp     Ordem das chaves.
+            */
+            flat_set( std::initializer_list<Key> list, const Compare &comp = Compare() )
+                : flat_set(list.begin(), list.end(), comp)
+            { }
+
+            /**
+            * @brief Retorna o número de chaves.
+            */
+            size_type size( void ) const{
+                return m_keys.size();
+            }
+            /**
+            * @brief Retorna true se o conjunto estiver vazio.
+            */
+            bool empty( void ) const{
+                return m_keys.empty();
+            }
+            /**
+            * @brief Remove todas as chaves. A capacidade não é alterada.
+            */
+            void clear( void ){
+                m_keys.clear();
+            }
+            /**
+            * @brief Reserva espaço para n chaves.
+            * @param n     Capacidade desejada.
+            */
+            void reserve( size_type n ){
+                m_keys.reserve(n);
+            }
+            /**
+            * @brief Retorna as chaves, em ordem, como um span contíguo.
+            */
+            span<const Key> keys( void ) const{
+                return span<const Key>(m_keys);
+            }
+            /**
+            * @brief Retorna um iterador para a menor chave.
+            */
+            const_iterator begin( void ) const{
+                return m_keys.cbegin();
+            }
+            /**
+            * @brief Retorna um iterador para a posição logo após a maior chave.
+            */
+            const_iterator end( void ) const{
+                return m_keys.cend();
+            }
+
+            /**
+            * @brief Retorna um iterador para a primeira chave que não é menor que key.
+            * @param key     Chave procurada.
+            */
+            const_iterator lower_bound( const Key &key ) const{
+                return begin() + lower_index(key);
+            }
+            /**
+            * @brief Retorna um iterador para a primeira chave maior que key.
+            * @param key     Chave procurada.
+            */
+            const_iterator upper_bound( const Key &key ) const{
+                size_type i = lower_index(key);
+                return begin() + (i != size() and not m_comp(key, m_keys[i]) ? i + 1 : i);
+            }
+            /**
+            * @brief Retorna um iterador para a chave equivalente a key, ou end() se não houver.
+            * @param key     Chave procurada.
+            */
+            const_iterator find( const Key &key ) const{
+                size_type i = lower_index(key);
+                return i != size() and not m_comp(key, m_keys[i]) ? begin() + i : end();
+            }
+            /**
+            * @brief Retorna true se o conjunto contém key.
+            * @param key     Chave procurada.
+            */
+            bool contains( const Key &key ) const{
+                return find(key) != end();
+            }
+            /**
+            * @brief Retorna 1 se o conjunto contém key, e 0 caso contrário.
+            * @param key     Chave procurada.
+            */
+            size_type count( const Key &key ) const{
+                return contains(key) ? 1 : 0;
+            }
+
+            /**
+            * @brief Insere key na posição ordenada (O(n), desloca a cauda). Retorna um iterador para a chave e true se
+            * ela foi inserida, ou false se já existia.
+            * @param key     Chave.
+            */
+            std::pair<const_iterator, bool> insert( const Key &key ){
+                size_type i = lower_index(key);
+                if(i != size() and not m_comp(key, m_keys[i]))
+                    return { begin() + i, false };
+                m_keys.insert(m_keys.cbegin() + i, key);
+                return { begin() + i, true };
+            }
+            /**
+            * @brief Insere as chaves do intervalo first-last de uma vez: numa cópia das chaves atuais, acrescenta-as ao
+            * final, ordena só as novas, intercala com as antigas (inplace_merge) e remove repetições, em
+            * O((n + m) + m log m) no total. A cópia só substitui as chaves ao final: se a comparação ou a cópia de uma
+            * chave lançar exceção, o conjunto não muda.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+            void insert( InputIt first, InputIt last ){
+                vector<Key> keys;
+                keys.reserve(size());
+                keys.append_range(m_keys.cbegin(), m_keys.cend());
+                keys.append_range(first, last); // lê iteradores de entrada uma única vez
+                Key *data = keys.data();
+                Key *middle = data + size();
+                Key *tail = data + keys.size();
+                // stable_sort e inplace_merge preservam a ordem entre equivalentes: a chave mais antiga vence.
+                std::stable_sort(middle, tail, m_comp);
+                std::inplace_merge(data, middle, tail, m_comp);
+                Key *unique_end = std::unique(data, tail, [this]( const Key &a, const Key &b ){ return equivalent(a, b); });
+                keys.erase(keys.cbegin() + (unique_end - data), keys.cend());
+                m_keys.swap(keys);
+            }
+            /**
+            * @brief Insere as chaves da lista de inicializadores de uma vez.
+            * @param list     Lista de inicializadores.
+            */
+            void insert( std::initializer_list<Key> list ){
+                insert(list.begin(), list.end());
+            }
+            /**
+            * @brief Remove a chave equivalente a key, se existir, e retorna quantas foram removidas (0 ou 1).
+            * @param key     Chave.
+            */
+            size_type erase( const Key &key ){
+                const_iterator it = find(key);
+                if(it == end())
+                    return 0;
+                m_keys.erase(it);
+                return 1;
+            }
+            /**
+            * @brief Remove a chave na posição it e retorna um iterador para a seguinte.
+            * @param it     Posição.
+            */
+            const_iterator erase( const_iterator it ){
+                return m_keys.erase(it);
+            }
+
+            /**
+            * @brief Verifica se os dois conjuntos têm as mesmas chaves.
+            * @param other     Conjunto.
+            */
+            bool operator==( const flat_set &other ) const{
+                return m_keys == other.m_keys;
+            }
+            /**
+            * @brief Verifica se os conjuntos têm chaves diferentes.
+            * @param other     Conjunto.
+            */
+            bool operator!=( const flat_set &other ) const{
+                return not (*this == other);
+            }
+        };
+    }
+
+#endif
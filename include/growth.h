@@ -0,0 +1,111 @@
+/**
+ * @file growth.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Políticas de crescimento da capacidade usadas por sc::vector
+*/
+
+#ifndef GROWTH_H
+#define GROWTH_H
+
+#include <algorithm>            // std::max
+#include <cstddef>              // std::size_t
+#include <type_traits>          // std::false_type, std::true_type
+
+#include "stats.h"
+
+    namespace sc{
+        /**
+        * @brief Políticas de crescimento. Cada política expõe
+        * `static std::size_t next_capacity( current, required, element_size )`, que recebe a capacidade atual,
+        * o tamanho mínimo pedido e o tamanho de um elemento em bytes, e retorna a nova capacidade (sempre >= required).
+        */
+        namespace growth{
+            /**
+            * @brief Dobra a capacidade a cada realocação. Menos realocações, mais memória ociosa.
+            */
+            struct doubling {
+                static std::size_t next_capacity( std::size_t current, std::size_t required, std::size_t ){
+                    return std::max(current * 2, required);
+                }
+            };
+            /**
+            * @brief Cresce 1,5x a cada realocação. Como 1 + 1,5 + 1,5² ... ultrapassa o próximo bloco, a memória liberada pelos blocos anteriores pode ser reaproveitada pelo alocador.
+            */
+            struct one_and_half {
+                static std::size_t next_capacity( std::size_t current, std::size_t required, std::size_t ){
+                    return std::max(current + current / 2, required);
+                }
+            };
+            /**
+            * @brief Dobra a capacidade e arredonda o bloco para um múltiplo de PageSize bytes, para que o alocador entregue páginas inteiras. Blocos menores que uma página crescem como doubling.
+            * @tparam PageSize     Tamanho da página em bytes (potência de 2).
+            */
+            template <std::size_t PageSize = 4096>
+            struct page_rounded {
+                static_assert((PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+                static std::size_t next_capacity( std::size_t current, std::size_t required, std::size_t element_size ){
+                    std::size_t wanted = std::max(current * 2, required);
+                    std::size_t bytes = wanted * element_size;
+                    if(bytes < PageSize)
+                        return wanted;
+                    bytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+                    return bytes / element_size;
+                }
+            };
+            /**
+            * @brief page_rounded com páginas enormes (huge pages) de 2 MB, para vetores grandes e sensíveis a realocações.
+            */
+            using huge_page_rounded = page_rounded<2 * 1024 * 1024>;
+            /**
+            * @brief Cresce como Policy e também encolhe: depois de erase, pop_back, pop_front, clear e resize para menos,
+            * se size() ficar abaixo de Percent% de capacity(), a lista realoca para max(2 * size(), MinCapacity) e devolve
+            * o bloco antigo. Cada elemento copiado ao encolher corresponde a pelo menos um elemento removido desde a última
+            * realocação, então o custo continua O(1) amortizado. Listas que crescem num pico e depois esvaziam não retêm o
+            * pico; o bloco nunca encolhe abaixo de MinCapacity, para que uma lista que oscila perto de vazia (push_back e
+            * pop_back alternados) não aloque e libere a cada operação. Só trim() e shrink_to_fit() liberam o bloco inteiro.
+            * @tparam Policy          Política de crescimento.
+            * @tparam Percent         Ocupação mínima, em porcentagem da capacidade (menor que 50, para não oscilar).
+            * @tparam MinCapacity     Capacidade abaixo da qual a lista não encolhe sozinha.
+            */
+            template <typename Policy = doubling, std::size_t Percent = 25, std::size_t MinCapacity = 16>
+            struct trimmed : Policy {
+                static_assert(Percent > 0 and Percent < 50, "Percent must be in (0, 50)");
+
+                static constexpr std::size_t trim_percent = Percent;
+                static constexpr std::size_t trim_min_capacity = MinCapacity;
+            };
+
+            template <typename Policy>
+            struct is_trimmed : std::false_type { };
+            template <typename Policy, std::size_t Percent, std::size_t MinCapacity>
+            struct is_trimmed< trimmed<Policy, Percent, MinCapacity> > : std::true_type { };
+            // counted<trimmed<P>> também encolhe: counted herda trim_percent e trim_min_capacity de trimmed.
+            template <typename Policy>
+            struct is_trimmed< stats::counted<Policy> > : is_trimmed<Policy> { };
+
+            /**
+            * @brief A partir deste tamanho de bloco (64 MB), vector::trim() não copia os elementos para um bloco menor:
+            * as páginas além do último elemento são devolvidas ao sistema com madvise(MADV_DONTNEED).
+            */
+            constexpr std::size_t release_in_place_bytes = std::size_t(64) << 20;
+
+            /**
+            * @brief Política usada quando nenhuma é dada: doubling, com contagem (ver stats.h) se SC_VECTOR_STATS estiver definida.
+            */
+#ifdef SC_VECTOR_STATS
+            using default_policy = stats::counted<doubling>;
+#else
+            using default_policy = doubling;
+#endif
+        }
+
+        namespace stats{
+            // trimmed<counted<P>> também conta.
+            template <typename Policy, std::size_t Percent, std::size_t MinCapacity>
+            struct is_counted< growth::trimmed<Policy, Percent, MinCapacity> > : is_counted<Policy> { };
+        }
+    }
+
+#endif
@@ -5,29 +5,91 @@
  * @brief Implementação da classe Iterator em C++
 */
 
+#ifndef ITERATOR_H
+#define ITERATOR_H
+
+#include <cstddef>              // std::ptrdiff_t
+#include <iterator>             // std::random_access_iterator_tag, std::contiguous_iterator_tag
+#include <type_traits>          // std::remove_cv, std::enable_if
+
+#include "debug.h"
+
 template <typename T>
 class MyIterator {
 
     private :
         T *current;
+#ifdef SC_VECTOR_DEBUG
+        std::shared_ptr<const sc::debug::state> m_state; //!< Estado da lista dona (nulo se o iterador não veio de uma lista).
+        unsigned long m_generation; //!< Geração da lista quando o iterador foi criado.
+
+        /**
+        * @brief Encerra o programa se a lista dona invalidou o iterador.
+        */
+        void check( void ) const{
+            SC_DEBUG_CHECK(m_state == nullptr or m_state->generation == m_generation,
+                           "iterator used after its vector reallocated, was cleared or was destroyed");
+        }
+#endif
+
+        template <typename> friend class MyIterator; // iterator -> const_iterator
 
     public :
         // Below we have the iterator_traits common interface
         /// Difference type used to calculated distance between iterators.
 
-        using value_type = T;
+        using value_type = typename std::remove_cv<T>::type;
         using pointer = T *;
         using reference = T &;
         using difference_type = std::ptrdiff_t; // <! Difference type used to calculated distance between pointers.
-        using iterator_category = std::bidirectional_iterator_tag; // <! Iterator category.
+        using iterator_category = std::random_access_iterator_tag; // <! Iterator category.
+#if __cplusplus > 201703L
+        using iterator_concept = std::contiguous_iterator_tag; // <! Os elementos são contíguos na memória (C++20).
+#endif
 
         MyIterator( T * current_ = nullptr )
             : current(current_)
+#ifdef SC_VECTOR_DEBUG
+            , m_state()
+            , m_generation(0)
+#endif
         { }
+#ifdef SC_VECTOR_DEBUG
+        /**
+        * @brief Cria um iterador verificado, ligado ao estado da lista dona.
+        * @param current_     Posição.
+        * @param owner        Estado da lista.
+        */
+        MyIterator( T * current_, std::shared_ptr<const sc::debug::state> owner )
+            : current(current_)
+            , m_state(std::move(owner))
+            , m_generation(m_state->generation)
+        { }
+        /**
+        * @brief Encerra o programa se o iterador não for da lista com estado owner ou se tiver sido invalidado.
+        * @param owner     Estado da lista que recebeu o iterador.
+        */
+        void check_owner( const sc::debug::state *owner ) const{
+            SC_DEBUG_CHECK(m_state == nullptr or m_state.get() == owner, "iterator passed to a vector it does not belong to");
+            check();
+        }
+#endif
 
         MyIterator& operator =( const MyIterator& ) = default ;
         MyIterator( const MyIterator& ) = default ;
         /**
+        * @brief Converte um iterator em const_iterator (MyIterator<T> para MyIterator<const T>).
+        * @param other      Iterador não constante.
+        */
+        template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+        MyIterator( const MyIterator<U> &other )
+            : current(other.current)
+#ifdef SC_VECTOR_DEBUG
+            , m_state(other.m_state)
+            , m_generation(other.m_generation)
+#endif
+        { }
+        /**
         * @brief Avança o iterador para o próximo local dentro do vetor.
         */
         MyIterator& operator ++ ( ){ // ++it
@@ -37,7 +99,7 @@ class MyIterator {
         /**
         * @brief Avança o iterador para o próximo local dentro do vetor.
         */
-        MyIterator operator ++ ( T ){ // it++
+        MyIterator operator ++ ( int ){ // it++
             auto temp = *this;
             current++;
             return temp;
@@ -52,7 +114,7 @@ class MyIterator {
           /**
         * @brief Volta o iterador para o local anterior dentro do vetor.
         */
-        MyIterator operator -- ( T ){ // it--
+        MyIterator operator -- ( int ){ // it--
             auto temp = *this;
             current--;
             return temp;
@@ -61,16 +123,47 @@ class MyIterator {
         * @brief Retorna uma referência ao objeto localizado na posição apontada pelo iterador.
         */
         reference operator * ( ) const{
+#ifdef SC_VECTOR_DEBUG
+            check();
+#endif
             return *current;
         }
         /**
         * @brief Retorna um ponteiro para a localização no vetor.
         */
         pointer operator ->( void ) const {
-            assert(current != nullptr);
+#ifdef SC_VECTOR_DEBUG
+            check();
+#endif
             return current;
         }
         /**
+        * @brief Retorna uma referência ao objeto n posições à frente do iterador.
+        * @param n      Deslocamento.
+        */
+        reference operator []( difference_type n ) const{
+#ifdef SC_VECTOR_DEBUG
+            check();
+#endif
+            return current[n];
+        }
+        /**
+        * @brief Avança o iterador n posições.
+        * @param n      Deslocamento.
+        */
+        MyIterator& operator +=( difference_type n ){
+            current += n;
+            return *this;
+        }
+        /**
+        * @brief Volta o iterador n posições.
+        * @param n      Deslocamento.
+        */
+        MyIterator& operator -=( difference_type n ){
+            current -= n;
+            return *this;
+        }
+        /**
         * @brief Retorna um iterador apontando para o n-ésimo sucessor no vetor a partir dele.
         * @param n      N-ésimo termo que será apontado.
         * @param i       Iterador.
@@ -89,36 +182,58 @@ class MyIterator {
             return i;
         }
         /**
-        * @brief Retorna um iterador apontando para o n-ésimo sucessor no vetor a partir dele.
+        * @brief Retorna um iterador apontando para o n-ésimo atecessor no vetor a partir dele.
         * @param n      N-ésimo termo que será apontado.
         * @param i       Iterador.
         */
-        friend MyIterator operator -( difference_type n, MyIterator i){
+        friend MyIterator operator -( MyIterator i, difference_type n){
             i.current -= n;
             return i;
         }
         /**
-        * @brief Retorna um iterador apontando para o n-ésimo atecessor no vetor a partir dele.
-        * @param n      N-ésimo termo que será apontado.
-        * @param i       Iterador.
+        * @brief Retorna a distância entre dois iteradores (quantidade de elementos de y até x).
+        * @param x       Iterador final.
+        * @param y       Iterador inicial.
         */
-        friend MyIterator operator -( MyIterator i, difference_type n){
-            i.current -= n;
-            return i;
+        friend difference_type operator -( const MyIterator &x, const MyIterator &y ){
+            return x.current - y.current;
         }
         /**
-        * @brief Retorna um iterador apontando para o n-ésimo atecessor no vetor a partir dele.
-        * @param n      N-ésimo termo que será apontado.
-        * @param i       Iterador.
+        * @brief Retorna verdadeiro se ambos os iteradores se referirem a mesma localização dentro do vetor, e falso caso contrário.
         */
-        bool operator == ( const MyIterator &x ) const{
-            return (current - x.current) == 0;
+        friend bool operator == ( const MyIterator &x, const MyIterator &y ){
+            return x.current == y.current;
         }
         /**
         * @brief Retorna verdadeiro se ambos os iteradores se referirem a um diferente localização dentro do vetor, e falso caso contrário.
         */
-        bool operator != ( const MyIterator &x ) const{
-            return (current - x.current) != 0;
-        }        
-        
-};
\ No newline at end of file
+        friend bool operator != ( const MyIterator &x, const MyIterator &y ){
+            return x.current != y.current;
+        }
+        /**
+        * @brief Retorna verdadeiro se x aponta para uma posição anterior a y.
+        */
+        friend bool operator < ( const MyIterator &x, const MyIterator &y ){
+            return x.current < y.current;
+        }
+        /**
+        * @brief Retorna verdadeiro se x aponta para uma posição posterior a y.
+        */
+        friend bool operator > ( const MyIterator &x, const MyIterator &y ){
+            return x.current > y.current;
+        }
+        /**
+        * @brief Retorna verdadeiro se x não aponta para uma posição posterior a y.
+        */
+        friend bool operator <= ( const MyIterator &x, const MyIterator &y ){
+            return x.current <= y.current;
+        }
+        /**
+        * @brief Retorna verdadeiro se x não aponta para uma posição anterior a y.
+        */
+        friend bool operator >= ( const MyIterator &x, const MyIterator &y ){
+            return x.current >= y.current;
+        }
+};
+
+#endif
@@ -0,0 +1,611 @@
+/**
+ * @file mmap_vector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Mmap Vector (lista persistente mapeada de um arquivo) em C++
+*/
+
+#ifndef MMAP_VECTOR_H
+#define MMAP_VECTOR_H
+
+#include <algorithm>            // std::max, std::fill_n, std::rotate
+#include <cerrno>               // errno
+#include <cstdint>              // std::uint32_t, std::uint64_t
+#include <cstring>              // std::memmove
+#include <iterator>             // std::distance
+#include <new>                  // placement new
+#include <stdexcept>            // std::out_of_range, std::runtime_error, std::logic_error
+#include <string>               // std::string
+#include <system_error>         // std::system_error
+#include <type_traits>          // std::is_trivially_copyable
+#include <utility>              // std::swap
+
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap, mremap, munmap, msync
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // ftruncate, close
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Como abrir o arquivo de uma sc::mmap_vector.
+        */
+        enum class open_mode {
+            read_only,      //!< Mapeia o arquivo existente só para leitura; nada é copiado nem alterado.
+            read_write,     //!< Mapeia o arquivo existente (ou cria um vazio) para leitura e escrita.
+            truncate        //!< Descarta o conteúdo do arquivo e começa uma lista vazia.
+        };
+
+        namespace detail{
+            /**
+            * @brief Identificador do tipo T gravado no cabeçalho do arquivo: FNV-1a do nome do tipo (extraído de
+            * __PRETTY_FUNCTION__). É estável entre execuções do mesmo programa, mas não entre compiladores diferentes.
+            */
+            template <typename T>
+            std::uint64_t type_fingerprint( void ){
+                std::uint64_t hash = 14695981039346656037ull;
+                for(const char *c = __PRETTY_FUNCTION__; *c != '\0'; ++c){
+                    hash ^= static_cast<unsigned char>(*c);
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+        }
+
+        /**
+        * @brief Lista contígua cujos elementos vivem num arquivo mapeado em memória (mmap). O arquivo começa com um
+        * cabeçalho (tamanho, capacidade e identificação do tipo), seguido dos elementos; a lista cresce com
+        * ftruncate + mremap, e o que for escrito nela persiste no arquivo. Abrir um arquivo com open_mode::read_only
+        * não copia nada: custa o mesmo para qualquer tamanho, e as páginas só são lidas do disco quando acessadas.
+        *
+        *     { sc::mmap_vector<int> snapshot("state.bin", sc::open_mode::truncate); snapshot.assign(v.begin(), v.end()); }
+        *     sc::mmap_vector<int> state("state.bin", sc::open_mode::read_only);
+        *
+        * Só aceita T trivialmente copiável, pois os bytes do arquivo são usados diretamente como objetos.
+        * @tparam T               Tipo dos elementos.
+        * @tparam GrowthPolicy    Regra de crescimento da capacidade (ver growth.h).
+        */
+        template <typename T, typename GrowthPolicy = growth::doubling >
+        class mmap_vector {
+            static_assert(std::is_trivially_copyable<T>::value, "mmap_vector requires a trivially copyable T");
+            static_assert(alignof(T) <= 64, "mmap_vector aligns elements to at most 64 bytes");
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using value_type = T; //!< The value type.
+            using growth_policy = GrowthPolicy; //!< The capacity growth policy.
+            using pointer = value_type*; //!< Pointer to a value stored in the container.
+            using reference = value_type&; //!< Reference to a value stored in the container.
+            using const_reference = const value_type&; //!< Const reference to a value stored in the container.
+            using iterator = MyIterator< T >; // See Code 3
+            using const_iterator = MyIterator< const T >; // See Code 3
+
+        private :
+            /// Cabeçalho no início do arquivo. Ocupa 64 bytes, de modo que os elementos começam alinhados.
+            struct alignas(64) header {
+                std::uint64_t magic;
+                std::uint32_t version;
+                std::uint32_t element_size;
+                std::uint64_t fingerprint;
+                std::uint64_t size;
+                std::uint64_t capacity;
+            };
+
+            static constexpr std::uint64_t file_magic = 0x524f544345564353ull; //!< "SCVECTOR".
+            static constexpr std::uint32_t file_version = 1;
+            static constexpr size_type header_bytes = sizeof(header);
+            /// Capacidade mínima: o primeiro crescimento já ocupa uma página inteira.
+            static constexpr size_type min_capacity = 4096 > header_bytes + sizeof(T) ? (4096 - header_bytes) / sizeof(T) : 1;
+
+            int m_fd;
+            bool m_writable;
+            header *m_header; //!< Início do mapeamento; os elementos vêm logo após o cabeçalho.
+            size_type m_mapped; //!< Bytes mapeados.
+
+            /**
+            * @brief Retorna o início dos elementos.
+            */
+            pointer storage( void ) const{
+                return reinterpret_cast<pointer>(reinterpret_cast<char *>(m_header) + header_bytes);
+            }
+            /**
+            * @brief Lança std::system_error com o errno atual.
+            * @param what     Chamada que falhou.
+            */
+            [[noreturn]] static void fail( const char *what ){
+                throw std::system_error(errno, std::generic_category(), what);
+            }
+            /**
+            * @brief Lança std::logic_error se a lista foi aberta só para leitura.
+            * @param what     Operação tentada.
+            */
+            void require_writable( const char *what ) const{
+                if(not m_writable)
+                    throw std::logic_error(std::string(what) + " Cannot modify a read-only mmap_vector");
+            }
+            /**
+            * @brief Desfaz o mapeamento e fecha o arquivo.
+            */
+            void unmap( void ){
+                if(m_header != nullptr)
+                    ::munmap(m_header, m_mapped);
+                if(m_fd >= 0)
+                    ::close(m_fd);
+                m_fd = -1;
+                m_header = nullptr;
+                m_mapped = 0;
+            }
+            /**
+            * @brief Mapeia os primeiros bytes do arquivo aberto.
+            * @param bytes     Tamanho do mapeamento.
+            */
+            void map( size_type bytes ){
+                int protection = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+                void *p = ::mmap(nullptr, bytes, protection, MAP_SHARED, m_fd, 0);
+                if(p == MAP_FAILED)
+                    fail("[mmap_vector] mmap");
+                m_header = static_cast<header *>(p);
+                m_mapped = bytes;
+            }
+            /**
+            * @brief Confere se o cabeçalho do arquivo descreve uma lista de T que cabe em file_size bytes.
+            * @param file_size     Tamanho do arquivo.
+            */
+            void validate( size_type file_size ) const{
+                const header &h = *m_header;
+                if(h.magic != file_magic or h.version != file_version)
+                    throw std::runtime_error("[mmap_vector] File is not an sc::mmap_vector");
+                if(h.element_size != sizeof(T) or h.fingerprint != detail::type_fingerprint<T>())
+                    throw std::runtime_error("[mmap_vector] File holds elements of a different type");
+                if(h.size > h.capacity or (file_size - header_bytes) / sizeof(T) < h.capacity)
+                    throw std::runtime_error("[mmap_vector] File is truncated");
+            }
+            /**
+            * @brief Único ponto de realocação: muda o tamanho do arquivo (ftruncate) e do mapeamento (mremap) para
+            * new_cap elementos. Os elementos não são copiados pelo programa; o mapeamento pode mudar de endereço.
+            * @param new_cap     Nova capacidade.
+            */
+            void reallocate( size_type new_cap ){
+                size_type bytes = header_bytes + new_cap * sizeof(T);
+                // Ao crescer, o arquivo aumenta antes do mapeamento; ao diminuir, depois (nenhuma página mapeada fica sem arquivo).
+                if(bytes > m_mapped and ::ftruncate(m_fd, bytes) != 0)
+                    fail("[mmap_vector] ftruncate");
+                void *p = ::mremap(m_header, m_mapped, bytes, MREMAP_MAYMOVE);
+                if(p == MAP_FAILED)
+                    fail("[mmap_vector] mremap");
+                m_header = static_cast<header *>(p);
+                if(bytes < m_mapped and ::ftruncate(m_fd, bytes) != 0){
+                    m_mapped = bytes;
+                    fail("[mmap_vector] ftruncate");
+                }
+                m_mapped = bytes;
+                m_header->capacity = new_cap;
+            }
+            /**
+            * @brief Retorna a capacidade usada no próximo crescimento, segundo a GrowthPolicy.
+            * @param required     Quantidade mínima de posições necessária.
+            */
+            size_type next_capacity( size_type required ) const{
+                return std::max<size_type>(GrowthPolicy::next_capacity(capacity(), required, sizeof(T)), min_capacity);
+            }
+            /**
+            * @brief Garante capacidade para required elementos, crescendo segundo a GrowthPolicy.
+            * @param required     Quantidade mínima de posições necessária.
+            */
+            void grow_to( size_type required ){
+                if(required > capacity())
+                    reallocate(next_capacity(required));
+            }
+            /**
+            * @brief Abre n posições a partir de pos (deslocando a cauda com um memmove) e retorna o início delas.
+            * @param pos     Índice da inserção.
+            * @param n       Quantidade de posições.
+            */
+            pointer open_gap( size_type pos, size_type n ){
+                grow_to(size() + n);
+                pointer p = storage() + pos;
+                std::memmove(static_cast<void*>(p + n), static_cast<const void*>(p), (size() - pos) * sizeof(T));
+                m_header->size += n;
+                return p;
+            }
+
+        public :
+            /**
+            * @brief Abre (ou cria) o arquivo path como uma lista de T. Se o arquivo existir e não estiver vazio, seu
+            * cabeçalho é validado; se ele guardar outro tipo ou estiver truncado, uma exceção do tipo
+            * std::runtime_error é lançada. Falhas do sistema lançam std::system_error.
+            * @param path     Caminho do arquivo.
+            * @param mode     Modo de abertura.
+            */
+            explicit mmap_vector( const std::string &path, open_mode mode = open_mode::read_write )
+                : m_fd(-1)
+                , m_writable(mode != open_mode::read_only)
+                , m_header(nullptr)
+                , m_mapped(0)
+            {
+                int flags = O_RDONLY;
+                if(mode == open_mode::read_write)
+                    flags = O_RDWR | O_CREAT;
+                else if(mode == open_mode::truncate)
+                    flags = O_RDWR | O_CREAT | O_TRUNC;
+                m_fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+                if(m_fd < 0)
+                    fail("[mmap_vector] open");
+                try {
+                    struct stat info;
+                    if(::fstat(m_fd, &info) != 0)
+                        fail("[mmap_vector] fstat");
+                    size_type file_size = info.st_size;
+                    if(file_size == 0 and m_writable){
+                        if(::ftruncate(m_fd, header_bytes) != 0)
+                            fail("[mmap_vector] ftruncate");
+                        map(header_bytes);
+                        *m_header = header{ file_magic, file_version, static_cast<std::uint32_t>(sizeof(T)), detail::type_fingerprint<T>(), 0, 0 };
+                        return;
+                    }
+                    if(file_size < header_bytes)
+                        throw std::runtime_error("[mmap_vector] File is not an sc::mmap_vector");
+                    map(file_size);
+                    validate(file_size);
+                } catch(...) {
+                    unmap();
+                    throw;
+                }
+            }
+
+            mmap_vector( const mmap_vector & ) = delete;
+            mmap_vector& operator =( const mmap_vector & ) = delete;
+
+            /**
+            * @brief Um construtor de movimento. Toma posse do mapeamento de other, deixando-o fechado.
+            * @param other      Lista cujo mapeamento será tomado.
+            */
+            mmap_vector( mmap_vector &&other ) noexcept
+                : m_fd(other.m_fd)
+                , m_writable(other.m_writable)
+                , m_header(other.m_header)
+                , m_mapped(other.m_mapped)
+            {
+                other.m_fd = -1;
+                other.m_header = nullptr;
+                other.m_mapped = 0;
+            }
+            /**
+            * @brief Operador de atribuição por movimento. Fecha o arquivo atual e toma posse do mapeamento de other.
+            * @param other     O que será movido
+            */
+            mmap_vector& operator =( mmap_vector &&other ) noexcept{
+                mmap_vector temp(std::move(other));
+                swap(temp);
+                return *this;
+            }
+            /**
+            * @brief Desfaz o mapeamento e fecha o arquivo. O conteúdo já está no arquivo (o sistema o grava em disco
+            * quando quiser; use sync() para esperar a gravação).
+            */
+            ~mmap_vector( void ){
+                unmap();
+            }
+            /**
+            * @brief Troca o arquivo mapeado com o de other em O(1).
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap( mmap_vector &other ) noexcept{
+                using std::swap;
+                swap(m_fd, other.m_fd);
+                swap(m_writable, other.m_writable);
+                swap(m_header, other.m_header);
+                swap(m_mapped, other.m_mapped);
+            }
+
+            /**
+            * @brief Retorna true se a lista foi aberta com open_mode::read_only.
+            */
+            bool read_only( void ) const{
+                return not m_writable;
+            }
+            /**
+            * @brief Retorna true se a lista está aberta (false depois de ser movida).
+            */
+            bool is_open( void ) const{
+                return m_header != nullptr;
+            }
+            /**
+            * @brief Espera até que o conteúdo esteja gravado no disco (msync).
+            */
+            void sync( void ){
+                if(m_header != nullptr and m_writable and ::msync(m_header, m_mapped, MS_SYNC) != 0)
+                    fail("[mmap_vector] msync");
+            }
+
+            bool full( void ) const{
+                return size() == capacity();
+            }
+            /**
+            * @brief Retorna o número de elementos no container.
+            */
+            size_type size( void ) const{
+                return m_header == nullptr ? 0 : m_header->size;
+            }
+            /**
+            * @brief Retorna true se o container não contiver nenhum elemento, e false caso contrário.
+            */
+            bool empty( void ) const{
+                return size() == 0;
+            }
+            /**
+            * @brief Retorna a capacidade gravada no arquivo.
+            */
+            size_type capacity( void ) const{
+                return m_header == nullptr ? 0 : m_header->capacity;
+            }
+            /**
+            * @brief Aumenta a capacidade (e o arquivo) para new_cap elementos.
+            * @param new_cap     Nova capacidade.
+            */
+            void reserve( size_type new_cap ){
+                require_writable("[reserve()]");
+                if(new_cap > capacity())
+                    reallocate(new_cap);
+            }
+            /**
+            * @brief Diminui o arquivo até caber exatamente os elementos atuais.
+            */
+            void shrink_to_fit( void ){
+                require_writable("[shrink_to_fit()]");
+                if(size() < capacity())
+                    reallocate(size());
+            }
+            /**
+            * @brief Remove todos os elementos. A capacidade (e o tamanho do arquivo) não é alterada.
+            */
+            void clear( void ){
+                require_writable("[clear()]");
+                m_header->size = 0;
+            }
+            /**
+            * @brief Constrói um valor no final da lista a partir dos argumentos dados.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            reference emplace_back( Args&&... args ){
+                require_writable("[emplace_back()]");
+                value_type value(std::forward<Args>(args)...); // args podem referenciar elementos, e o mapeamento pode mudar de endereço
+                grow_to(size() + 1);
+                pointer p = ::new (static_cast<void*>(storage() + size())) value_type(value);
+                ++m_header->size;
+                return *p;
+            }
+            /**
+            * @brief Adiciona um valor ao final da lista.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_back( const_reference value ){
+                emplace_back(value);
+            }
+            /**
+            * @brief Remove o objeto no final da lista.
+            */
+            void pop_back( void ){
+                require_writable("[pop_back()]");
+                --m_header->size;
+            }
+            /**
+            * @brief Retorna o objeto no inicio da lista.
+            */
+            reference front( void ){
+                return storage()[0];
+            }
+            /**
+            * @brief Retorna o objeto no inicio da lista.
+            */
+            const_reference front( void ) const{
+                return storage()[0];
+            }
+            /**
+            * @brief Retorna o objeto no final da lista.
+            */
+            reference back( void ){
+                return storage()[size() - 1];
+            }
+            /**
+            * @brief Retorna o objeto no final da lista.
+            */
+            const_reference back( void ) const{
+                return storage()[size() - 1];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, sem verificação de limites. Numa lista aberta só para
+            * leitura, escrever pela referência retornada encerra o programa (a página é protegida contra escrita).
+            * @param pos     Posição do indice.
+            */
+            reference operator[]( size_type pos ){
+                return storage()[pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, sem verificação de limites.
+            * @param pos     Posição do indice.
+            */
+            const_reference operator[]( size_type pos ) const{
+                return storage()[pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, com verificação de limites. Se pos não estiver dentro do intervalo da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição do indice.
+            */
+            reference at( size_type pos ){
+                if(pos >= size())
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return storage()[pos];
+            }
+            /**
+            * @brief Retorna o objeto na posição do índice, com verificação de limites. Se pos não estiver dentro do intervalo da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição do indice.
+            */
+            const_reference at( size_type pos ) const{
+                if(pos >= size())
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return storage()[pos];
+            }
+            /**
+            * @brief Retorna um ponteiro para o primeiro elemento, dentro do mapeamento. Ele muda quando a lista cresce.
+            */
+            pointer data( void ){
+                return storage();
+            }
+            /**
+            * @brief Retorna um ponteiro constante para o primeiro elemento, dentro do mapeamento.
+            */
+            const value_type * data( void ) const{
+                return storage();
+            }
+
+            /**
+            * @brief Retorna um iterador apontando para o primeiro item da lista.
+            */
+            iterator begin( void ){
+                return iterator( storage() );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para o primeiro item na lista.
+            */
+            const_iterator begin( void ) const{
+                return const_iterator( storage() );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para o primeiro item na lista.
+            */
+            const_iterator cbegin( void ) const{
+                return const_iterator( storage() );
+            }
+            /**
+            * @brief Retorna um iterador apontando para a posição logo após o último elemento da lista.
+            */
+            iterator end( void ){
+                return iterator( storage() + size() );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para a posição logo após o último elemento da lista.
+            */
+            const_iterator end( void ) const{
+                return const_iterator( storage() + size() );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para a posição logo após o último elemento da lista.
+            */
+            const_iterator cend( void ) const{
+                return const_iterator( storage() + size() );
+            }
+
+            /**
+            * @brief Substitui o conteúdo da lista com count cópias de value.
+            * @param count     Quantidade de cópias.
+            * @param value     Valor que vai substituir.
+            */
+            void assign( size_type count, const_reference value ){
+                require_writable("[assign()]");
+                const value_type copy = value; // value pode estar dentro do mapeamento
+                if(count > capacity())
+                    reallocate(count);
+                std::fill_n(storage(), count, copy);
+                m_header->size = count;
+            }
+            /**
+            * @brief Substitui o conteúdo da lista por cópias dos elementos no intervalo first-last (ex.: um
+            * sc::vector inteiro, num único memcpy quando o intervalo é contíguo). Iteradores de entrada são lidos uma
+            * única vez, elemento a elemento.
+            * @param first    Inicio do intervalo.
+            * @param last     Fim do intervalo.
+            */
+            template < typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category >
+            void assign( InputItr first, InputItr last ){
+                require_writable("[assign()]");
+                if constexpr (detail::is_forward_iterator<InputItr>::value){
+                    size_type n = std::distance(first, last);
+                    if(n > capacity())
+                        reallocate(n);
+                    detail::copy_n(first, n, storage());
+                    m_header->size = n;
+                } else {
+                    m_header->size = 0;
+                    for(; first != last; ++first)
+                        emplace_back(*first);
+                }
+            }
+            /**
+            * @brief Adiciona valor antes da posição x e retorna um iterador para ele.
+            * @param x         Posição dada pelo Iterador.
+            * @param value     Valor a ser adicionado.
+            */
+            iterator insert( const_iterator x, const_reference value ){
+                require_writable("[insert()]");
+                size_type i = x - cbegin();
+                const value_type copy = value;
+                *open_gap(i, 1) = copy;
+                return begin() + i;
+            }
+            /**
+            * @brief Insere o intervalo first-last antes da posição x. O intervalo não pode estar dentro da própria lista.
+            * Iteradores de entrada são lidos uma única vez: os elementos são acrescentados ao final e depois girados
+            * para a posição x.
+            * @param x         Posição dada pelo Iterador.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            template < typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category >
+            iterator insert( const_iterator x, InputItr first, InputItr last ){
+                require_writable("[insert()]");
+                size_type i = x - cbegin();
+                if constexpr (detail::is_forward_iterator<InputItr>::value){
+                    size_type n = std::distance(first, last);
+                    if(n != 0)
+                        detail::copy_n(first, n, open_gap(i, n));
+                } else {
+                    size_type old_size = size();
+                    for(; first != last; ++first)
+                        emplace_back(*first);
+                    std::rotate(storage() + i, storage() + old_size, storage() + size());
+                }
+                return begin() + i;
+            }
+            /**
+            * @brief Remove os elementos no intervalo x-y com um único memmove.
+            * @param x     Inicio do intervalo.
+            * @param y     Fim do intervalo.
+            */
+            iterator erase( const_iterator x, const_iterator y ){
+                require_writable("[erase()]");
+                size_type first = x - cbegin();
+                size_type last = y - cbegin();
+                std::memmove(static_cast<void*>(storage() + first), static_cast<const void*>(storage() + last), (size() - last) * sizeof(T));
+                m_header->size -= last - first;
+                return begin() + first;
+            }
+            /**
+            * @brief Remove o objeto na posição x.
+            * @param x     Posição dada pelo Iterador.
+            */
+            iterator erase( const_iterator x ){
+                return erase(x, x + 1);
+            }
+            /**
+            * @brief Copia os elementos para um sc::vector na memória comum (um único memcpy).
+            */
+            vector<T> to_vector( void ) const{
+                return vector<T>(cbegin(), cend());
+            }
+        };
+
+        /**
+        * @brief Troca os arquivos mapeados de duas listas em O(1).
+        * @param lhs     Primeira lista.
+        * @param rhs     Segunda lista.
+        */
+        template <typename T, typename GrowthPolicy>
+        void swap( mmap_vector<T, GrowthPolicy> &lhs, mmap_vector<T, GrowthPolicy> &rhs ) noexcept{
+            lhs.swap(rhs);
+        }
+    }
+
+#endif
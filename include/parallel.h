@@ -0,0 +1,132 @@
+/**
+ * @file parallel.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Algoritmos paralelos (for_each, transform, reduce, sort, fill) sobre sc::vector
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>            // std::sort, std::inplace_merge, std::fill
+#include <cstddef>              // std::size_t
+#include <functional>           // std::plus, std::less
+#include <optional>             // std::optional
+#include <vector>               // std::vector
+
+#include "thread_pool.h"
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Algoritmos que dividem [begin(), end()) em blocos alinhados a linhas de cache e os processam no pool
+        * compartilhado (ver thread_pool.h). Abaixo de serial_cutoff() elementos (padrão 2^20) executam em série.
+        * Funções passadas a eles são chamadas de várias threads ao mesmo tempo, para elementos diferentes.
+        */
+        namespace parallel{
+            /**
+            * @brief Chama f(x) para cada elemento x da lista.
+            * @param vec     Lista.
+            * @param f       Função aplicada.
+            */
+            template <typename T, typename Allocator, typename GrowthPolicy, typename F>
+            void for_each( vector<T, Allocator, GrowthPolicy> &vec, F f ){
+                T *data = vec.data();
+                for_chunks(data, vec.size(), [&]( std::size_t, std::size_t first, std::size_t last ){
+                    for(std::size_t i = first; i < last; ++i)
+                        f(data[i]);
+                });
+            }
+            /**
+            * @brief Grava f(in[i]) em out[i]. Se out não tiver o tamanho de in, ele recebe in.size() valores U()
+            * antes. in e out podem ser a mesma lista.
+            * @param in      Lista de entrada.
+            * @param out     Lista de saída.
+            * @param f       Função aplicada.
+            */
+            template <typename T, typename A1, typename G1, typename U, typename A2, typename G2, typename F>
+            void transform( const vector<T, A1, G1> &in, vector<U, A2, G2> &out, F f ){
+                if(out.size() != in.size())
+                    out.assign(in.size(), U());
+                const T *source = in.data();
+                U *dest = out.data();
+                for_chunks(dest, out.size(), [&]( std::size_t, std::size_t first, std::size_t last ){
+                    for(std::size_t i = first; i < last; ++i)
+                        dest[i] = f(source[i]);
+                });
+            }
+            /**
+            * @brief Combina init e todos os elementos com op. Cada bloco é reduzido separadamente e os resultados
+            * parciais são combinados na ordem dos blocos, então op deve ser associativa. O resultado tem o tipo de
+            * init (ex.: reduce(vec_de_int, 0LL) soma em long long).
+            * @param vec      Lista.
+            * @param init     Valor inicial.
+            * @param op       Operação binária (padrão: soma).
+            */
+            template <typename T, typename Allocator, typename GrowthPolicy, typename U, typename BinaryOp = std::plus<> >
+            U reduce( const vector<T, Allocator, GrowthPolicy> &vec, U init, BinaryOp op = BinaryOp() ){
+                const T *data = vec.data();
+                partition p = split(data, vec.size());
+                std::vector<std::optional<U>> partial(p.chunks);
+                for_chunks(p, [&]( std::size_t k, std::size_t first, std::size_t last ){
+                    if(first == last)
+                        return;
+                    U result = data[first];
+                    for(std::size_t i = first + 1; i < last; ++i)
+                        result = op(std::move(result), data[i]);
+                    partial[k] = std::move(result);
+                });
+                for(auto &value : partial){
+                    if(value)
+                        init = op(std::move(init), std::move(*value));
+                }
+                return init;
+            }
+            /**
+            * @brief Substitui todos os elementos por cópias de value.
+            * @param vec       Lista.
+            * @param value     Valor copiado.
+            */
+            template <typename T, typename Allocator, typename GrowthPolicy>
+            void fill( vector<T, Allocator, GrowthPolicy> &vec, const T &value ){
+                const T copy = value; // value pode ser um dos elementos sobrescritos
+                T *data = vec.data();
+                for_chunks(data, vec.size(), [&]( std::size_t, std::size_t first, std::size_t last ){
+                    std::fill(data + first, data + last, copy);
+                });
+            }
+            /**
+            * @brief Ordena a lista (não estável). Cada bloco é ordenado em paralelo com std::sort; depois os blocos
+            * são intercalados dois a dois (std::inplace_merge), também em paralelo, até restar um só.
+            * @param vec      Lista.
+            * @param comp     Comparação (padrão: <).
+            */
+            template <typename T, typename Allocator, typename GrowthPolicy, typename Compare = std::less<> >
+            void sort( vector<T, Allocator, GrowthPolicy> &vec, Compare comp = Compare() ){
+                T *data = vec.data();
+                partition p = split(data, vec.size());
+                if(p.chunks == 1){
+                    std::sort(data, data + vec.size(), comp);
+                    return;
+                }
+                for_chunks(p, [&]( std::size_t, std::size_t first, std::size_t last ){
+                    std::sort(data + first, data + last, comp);
+                });
+                // Cada rodada intercala os pares de sequências de width blocos: [k, k + width) com [k + width, k + 2 * width).
+                for(std::size_t width = 1; width < p.chunks; width *= 2){
+                    std::size_t pairs = (p.chunks + 2 * width - 1) / (2 * width);
+                    default_pool().run(pairs, [&]( std::size_t j ){
+                        std::size_t k = j * 2 * width;
+                        if(k + width >= p.chunks)
+                            return;
+                        T *first = data + p.boundary(k);
+                        T *middle = data + p.boundary(k + width);
+                        T *last = data + p.boundary(std::min(k + 2 * width, p.chunks));
+                        std::inplace_merge(first, middle, last, comp);
+                    });
+                }
+            }
+        }
+    }
+
+#endif
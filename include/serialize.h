@@ -0,0 +1,625 @@
+/**
+ * @file serialize.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Serialização binária de sc::vector para std::ostream, descritores de arquivo e buffers
+*/
+
+#ifndef SERIALIZE_H
+#define SERIALIZE_H
+
+#include <cerrno>               // errno, EINTR
+#include <climits>              // IOV_MAX
+#include <cstddef>              // std::size_t
+#include <cstdint>              // std::uint16_t, std::uint32_t, std::uint64_t, SIZE_MAX
+#include <algorithm>            // std::min
+#include <cstring>              // std::memcpy
+#include <exception>            // std::uncaught_exceptions
+#include <istream>              // std::istream
+#include <memory>               // std::unique_ptr
+#include <ostream>              // std::ostream
+#include <stdexcept>            // std::runtime_error
+#include <string>               // std::basic_string
+#include <system_error>         // std::system_error
+#include <type_traits>          // std::is_trivially_copyable
+
+#include <sys/uio.h>            // writev, iovec
+#include <unistd.h>             // read, lseek
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Como gravar e ler um elemento fora do caminho em bloco. Há especializações para tipos trivialmente
+        * copiáveis (gravados em bloco, bulk = true) e para std::basic_string (comprimento + caracteres). Para outros
+        * tipos, especialize com
+        *
+        *     template <typename Sink>   static void write( Sink &out, const T &value );
+        *     template <typename Source> static void read( Source &in, T &value );
+        *
+        * usando io::write_value/io::read_value para os campos.
+        */
+        template <typename T, typename = void>
+        struct serializer;
+
+        /**
+        * @brief Destinos (sinks) e origens (sources) de bytes. Um sink oferece write(p, n), writev(iov, count) e flush(),
+        * que grava o que ele ainda guardar; uma source oferece read(p, n), que lança exceção se a entrada terminar
+        * antes de n bytes.
+        */
+        namespace io{
+            /**
+            * @brief Grava em um std::ostream, sem descarregá-lo (flush) a cada chamada.
+            */
+            class ostream_sink {
+                std::ostream &m_os;
+
+            public :
+                explicit ostream_sink( std::ostream &os ) : m_os(os) { }
+
+                void write( const void *p, std::size_t n ){
+                    if(not m_os.write(static_cast<const char *>(p), n))
+                        throw std::runtime_error("[serialize()] Cannot write to the stream");
+                }
+                void writev( const ::iovec *iov, int count ){
+                    for(int i = 0; i < count; ++i)
+                        write(iov[i].iov_base, iov[i].iov_len);
+                }
+                void flush( void ){ }
+            };
+            /**
+            * @brief Tamanho do buffer de fd_sink e fd_source.
+            */
+            constexpr std::size_t fd_buffer_size = 64 * 1024;
+            /**
+            * @brief Quantos bytes a leitura reserva de uma vez. Quantidades e comprimentos vêm da própria entrada: a
+            * memória cresce em passos deste tamanho, conforme os dados chegam, para que uma entrada corrompida ou
+            * truncada termine em "Unexpected end of input" e não numa alocação gigantesca.
+            */
+            constexpr std::size_t read_step_bytes = 1024 * 1024;
+
+            /**
+            * @brief Grava em um descritor de arquivo através de um buffer de fd_buffer_size bytes, de modo que muitos
+            * elementos pequenos (ex.: strings) saiam juntos numa única chamada de sistema. Blocos grandes não são
+            * copiados: saem com o conteúdo do buffer numa única chamada writev. O que restar no buffer é gravado por
+            * flush() (chamada por stream_writer::close()) ou pelo destrutor, que ignora erros.
+            */
+            class fd_sink {
+                int m_fd;
+                std::unique_ptr<char[]> m_buffer;
+                std::size_t m_used; //!< Bytes no buffer ainda não gravados.
+
+                /**
+                * @brief Grava todos os blocos, repetindo a chamada até o fim (escritas parciais em pipes e sockets).
+                */
+                void write_all( ::iovec *iov, int count ){
+                    while(count > 0){
+                        ssize_t written = ::writev(m_fd, iov, count > IOV_MAX ? IOV_MAX : count);
+                        if(written < 0){
+                            if(errno == EINTR)
+                                continue;
+                            throw std::system_error(errno, std::generic_category(), "[serialize()] writev");
+                        }
+                        std::size_t left = written;
+                        while(count > 0 and left >= iov->iov_len){
+                            left -= iov->iov_len;
+                            ++iov;
+                            --count;
+                        }
+                        if(count > 0){
+                            iov->iov_base = static_cast<char *>(iov->iov_base) + left;
+                            iov->iov_len -= left;
+                        }
+                    }
+                }
+
+            public :
+                explicit fd_sink( int fd ) : m_fd(fd), m_buffer(new char[fd_buffer_size]), m_used(0) { }
+
+                fd_sink( const fd_sink & ) = delete;
+                fd_sink& operator =( const fd_sink & ) = delete;
+
+                ~fd_sink( void ){
+                    try { flush(); } catch(...) { }
+                }
+
+                void write( const void *p, std::size_t n ){
+                    ::iovec iov{ const_cast<void *>(p), n };
+                    writev(&iov, 1);
+                }
+                void writev( const ::iovec *iov, int count ){
+                    std::size_t total = 0;
+                    for(int i = 0; i < count; ++i)
+                        total += iov[i].iov_len;
+                    if(total < fd_buffer_size){
+                        if(m_used + total > fd_buffer_size)
+                            flush();
+                        for(int i = 0; i < count; ++i){
+                            std::memcpy(m_buffer.get() + m_used, iov[i].iov_base, iov[i].iov_len);
+                            m_used += iov[i].iov_len;
+                        }
+                        return;
+                    }
+                    vector<::iovec> parts;
+                    parts.reserve(count + 1);
+                    if(m_used != 0)
+                        parts.push_back(::iovec{ m_buffer.get(), m_used });
+                    parts.append(iov, count);
+                    m_used = 0;
+                    write_all(parts.data(), static_cast<int>(parts.size()));
+                }
+                /**
+                * @brief Grava o conteúdo do buffer.
+                */
+                void flush( void ){
+                    if(m_used == 0)
+                        return;
+                    ::iovec iov{ m_buffer.get(), m_used };
+                    m_used = 0;
+                    write_all(&iov, 1);
+                }
+            };
+            /**
+            * @brief Grava ao final de um sc::vector<char>.
+            */
+            class buffer_sink {
+                vector<char> &m_buffer;
+
+            public :
+                explicit buffer_sink( vector<char> &buffer ) : m_buffer(buffer) { }
+
+                void write( const void *p, std::size_t n ){
+                    const char *bytes = static_cast<const char *>(p);
+                    m_buffer.insert(m_buffer.cend(), bytes, bytes + n);
+                }
+                void writev( const ::iovec *iov, int count ){
+                    for(int i = 0; i < count; ++i)
+                        write(iov[i].iov_base, iov[i].iov_len);
+                }
+                void flush( void ){ }
+            };
+            /**
+            * @brief Lê de um std::istream.
+            */
+            class istream_source {
+                std::istream &m_is;
+
+            public :
+                explicit istream_source( std::istream &is ) : m_is(is) { }
+
+                void read( void *p, std::size_t n ){
+                    if(not m_is.read(static_cast<char *>(p), n))
+                        throw std::runtime_error("[deserialize()] Unexpected end of input");
+                }
+            };
+            /**
+            * @brief Lê de um descritor de arquivo através de um buffer de fd_buffer_size bytes, de modo que o prefixo de
+            * tamanho e o conteúdo de muitas strings venham de uma única chamada read. Leituras maiores que o buffer vão
+            * direto ao destino. A leitura adiantada pode passar do fim da sequência: no destrutor, os bytes não usados
+            * são devolvidos com lseek se o descritor permitir (arquivos); em pipes e sockets eles se perdem, então
+            * várias sequências seguidas no mesmo pipe devem ser lidas com um único fd_source (ver deserialize_from).
+            */
+            class fd_source {
+                int m_fd;
+                std::unique_ptr<char[]> m_buffer;
+                std::size_t m_pos; //!< Próximo byte não lido do buffer.
+                std::size_t m_end; //!< Fim dos bytes válidos do buffer.
+
+                /**
+                * @brief Uma chamada read de até n bytes; lança exceção em erro ou no fim da entrada.
+                */
+                std::size_t read_some( char *dest, std::size_t n ){
+                    while(true){
+                        ssize_t got = ::read(m_fd, dest, n);
+                        if(got < 0){
+                            if(errno == EINTR)
+                                continue;
+                            throw std::system_error(errno, std::generic_category(), "[deserialize()] read");
+                        }
+                        if(got == 0)
+                            throw std::runtime_error("[deserialize()] Unexpected end of input");
+                        return got;
+                    }
+                }
+
+            public :
+                explicit fd_source( int fd ) : m_fd(fd), m_buffer(new char[fd_buffer_size]), m_pos(0), m_end(0) { }
+
+                fd_source( const fd_source & ) = delete;
+                fd_source& operator =( const fd_source & ) = delete;
+
+                ~fd_source( void ){
+                    if(m_end > m_pos)
+                        ::lseek(m_fd, -static_cast<off_t>(m_end - m_pos), SEEK_CUR); // falha em pipes: ignorada
+                }
+
+                void read( void *p, std::size_t n ){
+                    char *dest = static_cast<char *>(p);
+                    while(n > 0){
+                        if(m_pos == m_end){
+                            if(n >= fd_buffer_size){
+                                std::size_t got = read_some(dest, n);
+                                dest += got;
+                                n -= got;
+                                continue;
+                            }
+                            m_end = read_some(m_buffer.get(), fd_buffer_size);
+                            m_pos = 0;
+                        }
+                        std::size_t take = std::min(n, m_end - m_pos);
+                        std::memcpy(dest, m_buffer.get() + m_pos, take);
+                        m_pos += take;
+                        dest += take;
+                        n -= take;
+                    }
+                }
+            };
+            /**
+            * @brief Lê de um bloco de memória (ex.: um buffer_sink já preenchido ou um arquivo mapeado).
+            */
+            class buffer_source {
+                const char *m_data;
+                std::size_t m_size;
+                std::size_t m_pos;
+
+            public :
+                buffer_source( const void *data, std::size_t size ) : m_data(static_cast<const char *>(data)), m_size(size), m_pos(0) { }
+
+                void read( void *p, std::size_t n ){
+                    if(n > m_size - m_pos)
+                        throw std::runtime_error("[deserialize()] Unexpected end of input");
+                    std::memcpy(p, m_data + m_pos, n);
+                    m_pos += n;
+                }
+            };
+
+            /**
+            * @brief Grava os bytes de um valor trivialmente copiável.
+            * @param out       Destino.
+            * @param value     Valor gravado.
+            */
+            template <typename Sink, typename U>
+            void write_value( Sink &out, const U &value ){
+                static_assert(std::is_trivially_copyable<U>::value, "write_value requires a trivially copyable type");
+                out.write(&value, sizeof(U));
+            }
+            /**
+            * @brief Lê os bytes de um valor trivialmente copiável.
+            * @param in     Origem.
+            */
+            template <typename U, typename Source>
+            U read_value( Source &in ){
+                static_assert(std::is_trivially_copyable<U>::value, "read_value requires a trivially copyable type");
+                U value;
+                in.read(&value, sizeof(U));
+                return value;
+            }
+        }
+
+        template <typename T>
+        struct serializer<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> {
+            static constexpr bool bulk = true; //!< Blocos de elementos são gravados com um único write.
+
+            template <typename Sink>
+            static void write( Sink &out, const T &value ){
+                io::write_value(out, value);
+            }
+            template <typename Source>
+            static void read( Source &in, T &value ){
+                in.read(&value, sizeof(T));
+            }
+        };
+
+        template <typename Char, typename Traits, typename Allocator>
+        struct serializer<std::basic_string<Char, Traits, Allocator>, typename std::enable_if<std::is_trivially_copyable<Char>::value>::type> {
+            static constexpr bool bulk = false;
+
+            template <typename Sink>
+            static void write( Sink &out, const std::basic_string<Char, Traits, Allocator> &value ){
+                std::uint64_t length = value.size();
+                ::iovec iov[2] = { { &length, sizeof(length) }, { const_cast<Char *>(value.data()), value.size() * sizeof(Char) } };
+                out.writev(iov, 2);
+            }
+            template <typename Source>
+            static void read( Source &in, std::basic_string<Char, Traits, Allocator> &value ){
+                std::uint64_t length = io::read_value<std::uint64_t>(in);
+                if(length > value.max_size())
+                    throw std::runtime_error("[deserialize()] String length out of range");
+                value.clear();
+                // Cresce em passos de io::read_step_bytes: length pode vir de uma entrada corrompida.
+                while(value.size() < length){
+                    std::size_t done = value.size();
+                    std::size_t n = std::min<std::uint64_t>(length - done, io::read_step_bytes / sizeof(Char));
+                    value.resize(done + n);
+                    in.read(&value[done], n * sizeof(Char));
+                }
+            }
+        };
+
+        namespace detail{
+            /**
+            * @brief Cabeçalho da serialização. Depois dele vêm blocos (um std::uint64_t com a quantidade de elementos,
+            * seguido dos elementos) e um bloco vazio que marca o fim. Inteiros são gravados na ordem de bytes da máquina.
+            */
+            struct stream_header {
+                std::uint32_t magic;
+                std::uint16_t version;
+                std::uint16_t bulk; //!< 1 se os elementos foram gravados em bloco.
+                std::uint64_t element_size; //!< sizeof(T) no caminho em bloco; 0 no caminho elemento a elemento.
+            };
+
+            constexpr std::uint32_t stream_magic = 0x53564353; //!< "SCVS".
+            constexpr std::uint16_t stream_version = 1;
+
+            template <typename T>
+            stream_header make_stream_header( void ){
+                return stream_header{ stream_magic, stream_version, serializer<T>::bulk, serializer<T>::bulk ? sizeof(T) : 0 };
+            }
+        }
+
+        /**
+        * @brief Grava uma sequência de elementos em blocos, sem precisar conhecer o total antes, de modo que listas
+        * maiores que a memória possam ser gravadas aos pedaços. O fim é marcado por close() ou pelo destrutor, exceto
+        * quando o destrutor roda durante a propagação de uma exceção: a sequência fica sem marcador de fim, e
+        * stream_reader a recusa como truncada em vez de aceitar uma lista incompleta.
+        * @tparam T       Tipo dos elementos.
+        * @tparam Sink    Destino (ver io).
+        */
+        template <typename T, typename Sink>
+        class stream_writer {
+            Sink &m_out;
+            bool m_open;
+            int m_exceptions; //!< std::uncaught_exceptions() na construção.
+
+        public :
+            /**
+            * @brief Grava o cabeçalho em out.
+            * @param out     Destino.
+            */
+            explicit stream_writer( Sink &out )
+                : m_out(out)
+                , m_open(true)
+                , m_exceptions(std::uncaught_exceptions())
+            {
+                io::write_value(m_out, detail::make_stream_header<T>());
+            }
+
+            stream_writer( const stream_writer & ) = delete;
+            stream_writer& operator =( const stream_writer & ) = delete;
+
+            /**
+            * @brief Grava o marcador de fim, se close() ainda não foi chamada e a destruição não se deve a uma exceção.
+            */
+            ~stream_writer( void ){
+                if(m_open and std::uncaught_exceptions() == m_exceptions){
+                    try { close(); } catch(...) { }
+                }
+            }
+            /**
+            * @brief Grava n elementos a partir de first como um bloco. Para T trivialmente copiável, a quantidade e os
+            * elementos saem numa única chamada writev, sem cópia intermediária.
+            * @param first     Primeiro elemento.
+            * @param n         Quantidade de elementos.
+            */
+            void write( const T *first, std::size_t n ){
+                if(n == 0)
+                    return;
+                std::uint64_t count = n;
+                if constexpr (serializer<T>::bulk){
+                    ::iovec iov[2] = { { &count, sizeof(count) }, { const_cast<T *>(first), n * sizeof(T) } };
+                    m_out.writev(iov, 2);
+                } else {
+                    io::write_value(m_out, count);
+                    for(std::size_t i = 0; i < n; ++i)
+                        serializer<T>::write(m_out, first[i]);
+                }
+            }
+            /**
+            * @brief Grava todos os elementos de vec como um bloco.
+            * @param vec     Lista.
+            */
+            template <typename Allocator, typename GrowthPolicy>
+            void write( const vector<T, Allocator, GrowthPolicy> &vec ){
+                write(vec.data(), vec.size());
+            }
+            /**
+            * @brief Grava o marcador de fim. Nada mais pode ser gravado depois.
+            */
+            void close( void ){
+                m_open = false;
+                io::write_value(m_out, std::uint64_t(0));
+                m_out.flush();
+            }
+        };
+
+        /**
+        * @brief Lê, em lotes de tamanho limitado, uma sequência gravada por stream_writer ou serialize(), de modo que
+        * listas maiores que a memória possam ser processadas aos pedaços.
+        * @tparam T         Tipo dos elementos.
+        * @tparam Source    Origem (ver io).
+        */
+        template <typename T, typename Source>
+        class stream_reader {
+            Source &m_in;
+            std::uint64_t m_pending; //!< Elementos ainda não lidos do bloco atual.
+            bool m_done;
+
+            static constexpr std::size_t step = io::read_step_bytes / sizeof(T) != 0 ? io::read_step_bytes / sizeof(T) : 1; //!< Elementos reservados de uma vez.
+
+        public :
+            /**
+            * @brief Lê e confere o cabeçalho. Se ele não for de uma sequência de T, uma exceção do tipo
+            * std::runtime_error é lançada.
+            * @param in     Origem.
+            */
+            explicit stream_reader( Source &in )
+                : m_in(in)
+                , m_pending(0)
+                , m_done(false)
+            {
+                auto found = io::read_value<detail::stream_header>(m_in);
+                auto expected = detail::make_stream_header<T>();
+                if(found.magic != expected.magic or found.version != expected.version)
+                    throw std::runtime_error("[deserialize()] Input is not a serialized sc::vector");
+                if(found.bulk != expected.bulk or found.element_size != expected.element_size)
+                    throw std::runtime_error("[deserialize()] Input holds elements of a different type");
+            }
+            /**
+            * @brief Retorna true depois que o marcador de fim foi lido.
+            */
+            bool done( void ) const{
+                return m_done;
+            }
+            /**
+            * @brief Acrescenta ao final de out até max elementos (todos, se max for 0) e retorna quantos foram lidos;
+            * 0 significa que a sequência terminou. A lista cresce no máximo io::read_step_bytes por vez, conforme os
+            * elementos chegam, e não de uma vez pela quantidade anunciada no bloco.
+            * @param out     Lista que recebe os elementos.
+            * @param max     Limite de elementos lidos nesta chamada.
+            */
+            template <typename Allocator, typename GrowthPolicy>
+            std::size_t read( vector<T, Allocator, GrowthPolicy> &out, std::size_t max = 0 ){
+                std::size_t total = 0;
+                while(not m_done and (max == 0 or total < max)){
+                    if(m_pending == 0){
+                        m_pending = io::read_value<std::uint64_t>(m_in);
+                        if(m_pending > SIZE_MAX / sizeof(T))
+                            throw std::runtime_error("[deserialize()] Block size out of range");
+                        m_done = m_pending == 0;
+                        continue;
+                    }
+                    std::size_t n = m_pending;
+                    if(max != 0 and n > max - total)
+                        n = max - total;
+                    if constexpr (serializer<T>::bulk){
+                        std::size_t first = out.size();
+                        try {
+                            for(std::size_t got = 0; got < n; ){
+                                std::size_t chunk = std::min(n - got, step);
+                                // Os elementos novos não são inicializados: a leitura os preenche.
+                                out.resize_for_overwrite(first + got + chunk);
+                                m_in.read(out.data() + first + got, chunk * sizeof(T));
+                                got += chunk;
+                            }
+                        } catch(...) {
+                            out.resize(first);
+                            throw;
+                        }
+                    } else {
+                        out.reserve(out.size() + std::min(n, step));
+                        for(std::size_t i = 0; i < n; ++i){
+                            T value;
+                            serializer<T>::read(m_in, value);
+                            out.push_back(std::move(value));
+                        }
+                    }
+                    m_pending -= n;
+                    total += n;
+                }
+                return total;
+            }
+        };
+
+        /**
+        * @brief Grava vec em out: para T trivialmente copiável, o conteúdo de data() num único write, sem passar
+        * elemento a elemento; para outros tipos, cada elemento via sc::serializer (strings com prefixo de tamanho).
+        * @param vec     Lista.
+        * @param out     Destino.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy, typename Sink>
+        void serialize_to( const vector<T, Allocator, GrowthPolicy> &vec, Sink &out ){
+            stream_writer<T, Sink> writer(out);
+            writer.write(vec);
+            writer.close();
+        }
+        /**
+        * @brief Grava vec em um std::ostream (sem flush).
+        * @param vec     Lista.
+        * @param os      Stream de saída.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void serialize( const vector<T, Allocator, GrowthPolicy> &vec, std::ostream &os ){
+            io::ostream_sink out(os);
+            serialize_to(vec, out);
+        }
+        /**
+        * @brief Grava vec em um descritor de arquivo. Para T trivialmente copiável, cabeçalho, elementos e marcador de
+        * fim saem numa única chamada writev; os demais tipos passam pelo buffer de io::fd_sink, uma chamada a cada
+        * io::fd_buffer_size bytes.
+        * @param vec     Lista.
+        * @param fd      Descritor aberto para escrita.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void serialize( const vector<T, Allocator, GrowthPolicy> &vec, int fd ){
+            io::fd_sink out(fd);
+            if constexpr (serializer<T>::bulk){
+                auto header = detail::make_stream_header<T>();
+                std::uint64_t count = vec.size();
+                std::uint64_t end = 0;
+                ::iovec iov[4] = { { &header, sizeof(header) }, { &count, sizeof(count) },
+                                   { const_cast<T *>(vec.data()), vec.size() * sizeof(T) }, { &end, sizeof(end) } };
+                // Lista vazia: o bloco vazio já é o marcador de fim.
+                if(vec.empty())
+                    out.writev(iov, 2);
+                else
+                    out.writev(iov, 4);
+            } else
+                serialize_to(vec, out);
+            out.flush();
+        }
+        /**
+        * @brief Grava vec ao final de um buffer na memória.
+        * @param vec        Lista.
+        * @param buffer     Buffer de saída.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void serialize( const vector<T, Allocator, GrowthPolicy> &vec, vector<char> &buffer ){
+            io::buffer_sink out(buffer);
+            serialize_to(vec, out);
+        }
+
+        /**
+        * @brief Substitui o conteúdo de vec pelo que foi gravado em in.
+        * @param vec     Lista.
+        * @param in      Origem.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy, typename Source>
+        void deserialize_from( vector<T, Allocator, GrowthPolicy> &vec, Source &in ){
+            stream_reader<T, Source> reader(in);
+            vec.clear();
+            reader.read(vec);
+        }
+        /**
+        * @brief Substitui o conteúdo de vec pelo que foi gravado em um std::istream.
+        * @param vec     Lista.
+        * @param is      Stream de entrada.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void deserialize( vector<T, Allocator, GrowthPolicy> &vec, std::istream &is ){
+            io::istream_source in(is);
+            deserialize_from(vec, in);
+        }
+        /**
+        * @brief Substitui o conteúdo de vec pelo que foi gravado em um descritor de arquivo.
+        * @param vec     Lista.
+        * @param fd      Descritor aberto para leitura.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void deserialize( vector<T, Allocator, GrowthPolicy> &vec, int fd ){
+            io::fd_source in(fd);
+            deserialize_from(vec, in);
+        }
+        /**
+        * @brief Substitui o conteúdo de vec pelo que foi gravado em um bloco de memória.
+        * @param vec      Lista.
+        * @param data     Início do bloco.
+        * @param size     Tamanho do bloco em bytes.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void deserialize( vector<T, Allocator, GrowthPolicy> &vec, const void *data, std::size_t size ){
+            io::buffer_source in(data, size);
+            deserialize_from(vec, in);
+        }
+    }
+
+#endif
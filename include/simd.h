@@ -0,0 +1,460 @@
+/**
+ * @file simd.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Kernels vetorizados (SSE2/AVX2) de comparação e busca sobre blocos contíguos, usados por sc::vector
+*/
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstddef>              // std::size_t
+#include <cstdint>              // std::int32_t, std::uint8_t
+#include <type_traits>          // std::is_same, std::is_integral, std::conditional
+
+// SC_SIMD_X86 vale 1 quando os kernels SSE2/AVX2 estão disponíveis (GCC/Clang em x86 com SSE2).
+// Defina SC_SIMD_DISABLE para compilar apenas a versão escalar.
+#if !defined(SC_SIMD_DISABLE) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+    #define SC_SIMD_X86 1
+    #include <immintrin.h>
+    #define SC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SC_SIMD_X86 0
+#endif
+
+    namespace sc{
+        /**
+        * @brief Kernels de equal, find, count, min, max e sum sobre um bloco contíguo [p, p + n).
+        * Para int32_t, uint8_t, float e double há versões SSE2 e AVX2, escolhidas em tempo de execução
+        * conforme a CPU; os demais tipos (e as outras arquiteturas) usam a versão escalar. equal compara
+        * qualquer tipo inteiro byte a byte. Com NaN, min e max de ponto flutuante não são especificados, e
+        * sum de ponto flutuante soma em outra ordem que o laço escalar (o arredondamento pode diferir).
+        */
+        namespace simd{
+            /**
+            * @brief Tipo acumulador de sum: inteiros são somados em 64 bits, ponto flutuante no próprio tipo.
+            */
+            template <typename T>
+            using sum_type = typename std::conditional< std::is_integral<T>::value,
+                                 typename std::conditional< std::is_signed<T>::value, long long, unsigned long long >::type,
+                                 T >::type;
+
+            /**
+            * @brief Verdadeiro para os tipos que têm kernels vetorizados.
+            */
+            template <typename T>
+            struct is_vectorizable : std::integral_constant<bool,
+                std::is_same<T, std::int32_t>::value or std::is_same<T, std::uint8_t>::value or
+                std::is_same<T, float>::value or std::is_same<T, double>::value> { };
+
+            /**
+            * @brief Versões escalares (referência e fallback), válidas para qualquer T com ==, < e +.
+            */
+            namespace scalar{
+                template <typename T>
+                bool equal( const T *a, const T *b, std::size_t n ){
+                    for(std::size_t i = 0; i < n; ++i){
+                        if(not (a[i] == b[i]))
+                            return false;
+                    }
+                    return true;
+                }
+                template <typename T>
+                std::size_t find( const T *p, std::size_t n, const T &value ){
+                    for(std::size_t i = 0; i < n; ++i){
+                        if(p[i] == value)
+                            return i;
+                    }
+                    return n;
+                }
+                template <typename T>
+                std::size_t count( const T *p, std::size_t n, const T &value ){
+                    std::size_t total = 0;
+                    for(std::size_t i = 0; i < n; ++i)
+                        total += p[i] == value;
+                    return total;
+                }
+                template <typename T>
+                T min( const T *p, std::size_t n ){
+                    T result = p[0];
+                    for(std::size_t i = 1; i < n; ++i){
+                        if(p[i] < result)
+                            result = p[i];
+                    }
+                    return result;
+                }
+                template <typename T>
+                T max( const T *p, std::size_t n ){
+                    T result = p[0];
+                    for(std::size_t i = 1; i < n; ++i){
+                        if(result < p[i])
+                            result = p[i];
+                    }
+                    return result;
+                }
+                template <typename T>
+                sum_type<T> sum( const T *p, std::size_t n ){
+                    sum_type<T> total = 0;
+                    for(std::size_t i = 0; i < n; ++i)
+                        total += p[i];
+                    return total;
+                }
+            }
+
+#if SC_SIMD_X86
+
+// Kernels genéricos sobre uma tabela de operações K (um registrador de K::lanes elementos do tipo K::value).
+// São definidos uma vez por conjunto de instruções, com o atributo target correspondente, para que as
+// operações de K sejam expandidas dentro deles.
+#define SC_SIMD_KERNELS(TARGET)                                                                  \
+            template <typename K>                                                                \
+            TARGET bool equal( const typename K::value *a, const typename K::value *b, std::size_t n ){ \
+                constexpr unsigned all = K::lanes == 32 ? ~0u : (1u << K::lanes) - 1;            \
+                std::size_t i = 0;                                                               \
+                for(; i + K::lanes <= n; i += K::lanes){                                         \
+                    if(K::eq(K::load(a + i), K::load(b + i)) != all)                             \
+                        return false;                                                            \
+                }                                                                                \
+                return scalar::equal(a + i, b + i, n - i);                                       \
+            }                                                                                    \
+            template <typename K>                                                                \
+            TARGET std::size_t find( const typename K::value *p, std::size_t n, typename K::value value ){ \
+                const auto key = K::set1(value);                                                 \
+                std::size_t i = 0;                                                               \
+                for(; i + K::lanes <= n; i += K::lanes){                                         \
+                    unsigned mask = K::eq(K::load(p + i), key);                                  \
+                    if(mask != 0)                                                                \
+                        return i + __builtin_ctz(mask);                                          \
+                }                                                                                \
+                return i + scalar::find(p + i, n - i, value);                                    \
+            }                                                                                    \
+            template <typename K>                                                                \
+            TARGET std::size_t count( const typename K::value *p, std::size_t n, typename K::value value ){ \
+                const auto key = K::set1(value);                                                 \
+                std::size_t total = 0, i = 0;                                                    \
+                for(; i + K::lanes <= n; i += K::lanes)                                          \
+                    total += __builtin_popcount(K::eq(K::load(p + i), key));                     \
+                return total + scalar::count(p + i, n - i, value);                               \
+            }                                                                                    \
+            template <typename K>                                                                \
+            TARGET typename K::value min( const typename K::value *p, std::size_t n ){          \
+                if(n < K::lanes)                                                                 \
+                    return scalar::min(p, n);                                                    \
+                auto best = K::load(p);                                                          \
+                std::size_t i = K::lanes;                                                        \
+                for(; i + K::lanes <= n; i += K::lanes)                                          \
+                    best = K::min(best, K::load(p + i));                                         \
+                if(i < n) /* a cauda é relida a partir de n - lanes */                           \
+                    best = K::min(best, K::load(p + n - K::lanes));                              \
+                typename K::value parts[K::lanes];                                               \
+                K::store(parts, best);                                                           \
+                return scalar::min(parts, K::lanes);                                             \
+            }                                                                                    \
+            template <typename K>                                                                \
+            TARGET typename K::value max( const typename K::value *p, std::size_t n ){          \
+                if(n < K::lanes)                                                                 \
+                    return scalar::max(p, n);                                                    \
+                auto best = K::load(p);                                                          \
+                std::size_t i = K::lanes;                                                        \
+                for(; i + K::lanes <= n; i += K::lanes)                                          \
+                    best = K::max(best, K::load(p + i));                                         \
+                if(i < n)                                                                        \
+                    best = K::max(best, K::load(p + n - K::lanes));                              \
+                typename K::value parts[K::lanes];                                               \
+                K::store(parts, best);                                                           \
+                return scalar::max(parts, K::lanes);                                             \
+            }                                                                                    \
+            template <typename K>                                                                \
+            TARGET sum_type<typename K::value> sum( const typename K::value *p, std::size_t n ){ \
+                auto acc = K::acc_zero();                                                        \
+                std::size_t i = 0;                                                               \
+                for(; i + K::lanes <= n; i += K::lanes)                                          \
+                    acc = K::acc_add(acc, K::load(p + i));                                       \
+                return K::acc_reduce(acc) + scalar::sum(p + i, n - i);                           \
+            }
+
+            /**
+            * @brief Kernels SSE2 (presente em todo x86-64).
+            */
+            namespace sse2{
+                struct i32 {
+                    using value = std::int32_t;
+                    static constexpr std::size_t lanes = 4;
+                    static __m128i load( const value *p ){ return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+                    static void store( value *p, __m128i x ){ _mm_storeu_si128(reinterpret_cast<__m128i *>(p), x); }
+                    static __m128i set1( value v ){ return _mm_set1_epi32(v); }
+                    static unsigned eq( __m128i a, __m128i b ){ return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+                    // SSE2 não tem min/max de inteiros de 32 bits: seleciona pela máscara de a > b.
+                    static __m128i min( __m128i a, __m128i b ){
+                        __m128i gt = _mm_cmpgt_epi32(a, b);
+                        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+                    }
+                    static __m128i max( __m128i a, __m128i b ){
+                        __m128i gt = _mm_cmpgt_epi32(a, b);
+                        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+                    }
+                    // Acumula em dois inteiros de 64 bits, estendendo o sinal de cada elemento.
+                    static __m128i acc_zero( void ){ return _mm_setzero_si128(); }
+                    static __m128i acc_add( __m128i acc, __m128i x ){
+                        __m128i sign = _mm_srai_epi32(x, 31);
+                        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+                        return _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+                    }
+                    static long long acc_reduce( __m128i acc ){
+                        long long parts[2];
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(parts), acc);
+                        return parts[0] + parts[1];
+                    }
+                };
+                struct u8 {
+                    using value = std::uint8_t;
+                    static constexpr std::size_t lanes = 16;
+                    static __m128i load( const value *p ){ return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+                    static void store( value *p, __m128i x ){ _mm_storeu_si128(reinterpret_cast<__m128i *>(p), x); }
+                    static __m128i set1( value v ){ return _mm_set1_epi8(static_cast<char>(v)); }
+                    static unsigned eq( __m128i a, __m128i b ){ return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)); }
+                    static __m128i min( __m128i a, __m128i b ){ return _mm_min_epu8(a, b); }
+                    static __m128i max( __m128i a, __m128i b ){ return _mm_max_epu8(a, b); }
+                    // psadbw contra zero soma cada grupo de 8 bytes num inteiro de 64 bits.
+                    static __m128i acc_zero( void ){ return _mm_setzero_si128(); }
+                    static __m128i acc_add( __m128i acc, __m128i x ){ return _mm_add_epi64(acc, _mm_sad_epu8(x, _mm_setzero_si128())); }
+                    static unsigned long long acc_reduce( __m128i acc ){
+                        unsigned long long parts[2];
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(parts), acc);
+                        return parts[0] + parts[1];
+                    }
+                };
+                struct f32 {
+                    using value = float;
+                    static constexpr std::size_t lanes = 4;
+                    static __m128 load( const value *p ){ return _mm_loadu_ps(p); }
+                    static void store( value *p, __m128 x ){ _mm_storeu_ps(p, x); }
+                    static __m128 set1( value v ){ return _mm_set1_ps(v); }
+                    static unsigned eq( __m128 a, __m128 b ){ return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+                    static __m128 min( __m128 a, __m128 b ){ return _mm_min_ps(a, b); }
+                    static __m128 max( __m128 a, __m128 b ){ return _mm_max_ps(a, b); }
+                    static __m128 acc_zero( void ){ return _mm_setzero_ps(); }
+                    static __m128 acc_add( __m128 acc, __m128 x ){ return _mm_add_ps(acc, x); }
+                    static float acc_reduce( __m128 acc ){
+                        float parts[4];
+                        _mm_storeu_ps(parts, acc);
+                        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+                    }
+                };
+                struct f64 {
+                    using value = double;
+                    static constexpr std::size_t lanes = 2;
+                    static __m128d load( const value *p ){ return _mm_loadu_pd(p); }
+                    static void store( value *p, __m128d x ){ _mm_storeu_pd(p, x); }
+                    static __m128d set1( value v ){ return _mm_set1_pd(v); }
+                    static unsigned eq( __m128d a, __m128d b ){ return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+                    static __m128d min( __m128d a, __m128d b ){ return _mm_min_pd(a, b); }
+                    static __m128d max( __m128d a, __m128d b ){ return _mm_max_pd(a, b); }
+                    static __m128d acc_zero( void ){ return _mm_setzero_pd(); }
+                    static __m128d acc_add( __m128d acc, __m128d x ){ return _mm_add_pd(acc, x); }
+                    static double acc_reduce( __m128d acc ){
+                        double parts[2];
+                        _mm_storeu_pd(parts, acc);
+                        return parts[0] + parts[1];
+                    }
+                };
+
+                SC_SIMD_KERNELS()
+            }
+
+            /**
+            * @brief Kernels AVX2 (registradores de 256 bits), usados somente se a CPU os suportar.
+            */
+            namespace avx2{
+                struct i32 {
+                    using value = std::int32_t;
+                    static constexpr std::size_t lanes = 8;
+                    SC_TARGET_AVX2 static __m256i load( const value *p ){ return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+                    SC_TARGET_AVX2 static void store( value *p, __m256i x ){ _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x); }
+                    SC_TARGET_AVX2 static __m256i set1( value v ){ return _mm256_set1_epi32(v); }
+                    SC_TARGET_AVX2 static unsigned eq( __m256i a, __m256i b ){ return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+                    SC_TARGET_AVX2 static __m256i min( __m256i a, __m256i b ){ return _mm256_min_epi32(a, b); }
+                    SC_TARGET_AVX2 static __m256i max( __m256i a, __m256i b ){ return _mm256_max_epi32(a, b); }
+                    SC_TARGET_AVX2 static __m256i acc_zero( void ){ return _mm256_setzero_si256(); }
+                    SC_TARGET_AVX2 static __m256i acc_add( __m256i acc, __m256i x ){
+                        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+                        return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+                    }
+                    SC_TARGET_AVX2 static long long acc_reduce( __m256i acc ){
+                        long long parts[4];
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(parts), acc);
+                        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+                    }
+                };
+                struct u8 {
+                    using value = std::uint8_t;
+                    static constexpr std::size_t lanes = 32;
+                    SC_TARGET_AVX2 static __m256i load( const value *p ){ return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+                    SC_TARGET_AVX2 static void store( value *p, __m256i x ){ _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x); }
+                    SC_TARGET_AVX2 static __m256i set1( value v ){ return _mm256_set1_epi8(static_cast<char>(v)); }
+                    SC_TARGET_AVX2 static unsigned eq( __m256i a, __m256i b ){ return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+                    SC_TARGET_AVX2 static __m256i min( __m256i a, __m256i b ){ return _mm256_min_epu8(a, b); }
+                    SC_TARGET_AVX2 static __m256i max( __m256i a, __m256i b ){ return _mm256_max_epu8(a, b); }
+                    SC_TARGET_AVX2 static __m256i acc_zero( void ){ return _mm256_setzero_si256(); }
+                    SC_TARGET_AVX2 static __m256i acc_add( __m256i acc, __m256i x ){ return _mm256_add_epi64(acc, _mm256_sad_epu8(x, _mm256_setzero_si256())); }
+                    SC_TARGET_AVX2 static unsigned long long acc_reduce( __m256i acc ){
+                        unsigned long long parts[4];
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(parts), acc);
+                        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+                    }
+                };
+                struct f32 {
+                    using value = float;
+                    static constexpr std::size_t lanes = 8;
+                    SC_TARGET_AVX2 static __m256 load( const value *p ){ return _mm256_loadu_ps(p); }
+                    SC_TARGET_AVX2 static void store( value *p, __m256 x ){ _mm256_storeu_ps(p, x); }
+                    SC_TARGET_AVX2 static __m256 set1( value v ){ return _mm256_set1_ps(v); }
+                    SC_TARGET_AVX2 static unsigned eq( __m256 a, __m256 b ){ return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+                    SC_TARGET_AVX2 static __m256 min( __m256 a, __m256 b ){ return _mm256_min_ps(a, b); }
+                    SC_TARGET_AVX2 static __m256 max( __m256 a, __m256 b ){ return _mm256_max_ps(a, b); }
+                    SC_TARGET_AVX2 static __m256 acc_zero( void ){ return _mm256_setzero_ps(); }
+                    SC_TARGET_AVX2 static __m256 acc_add( __m256 acc, __m256 x ){ return _mm256_add_ps(acc, x); }
+                    SC_TARGET_AVX2 static float acc_reduce( __m256 acc ){
+                        float parts[8];
+                        _mm256_storeu_ps(parts, acc);
+                        return ((parts[0] + parts[1]) + (parts[2] + parts[3])) + ((parts[4] + parts[5]) + (parts[6] + parts[7]));
+                    }
+                };
+                struct f64 {
+                    using value = double;
+                    static constexpr std::size_t lanes = 4;
+                    SC_TARGET_AVX2 static __m256d load( const value *p ){ return _mm256_loadu_pd(p); }
+                    SC_TARGET_AVX2 static void store( value *p, __m256d x ){ _mm256_storeu_pd(p, x); }
+                    SC_TARGET_AVX2 static __m256d set1( value v ){ return _mm256_set1_pd(v); }
+                    SC_TARGET_AVX2 static unsigned eq( __m256d a, __m256d b ){ return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+                    SC_TARGET_AVX2 static __m256d min( __m256d a, __m256d b ){ return _mm256_min_pd(a, b); }
+                    SC_TARGET_AVX2 static __m256d max( __m256d a, __m256d b ){ return _mm256_max_pd(a, b); }
+                    SC_TARGET_AVX2 static __m256d acc_zero( void ){ return _mm256_setzero_pd(); }
+                    SC_TARGET_AVX2 static __m256d acc_add( __m256d acc, __m256d x ){ return _mm256_add_pd(acc, x); }
+                    SC_TARGET_AVX2 static double acc_reduce( __m256d acc ){
+                        double parts[4];
+                        _mm256_storeu_pd(parts, acc);
+                        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+                    }
+                };
+
+                SC_SIMD_KERNELS(SC_TARGET_AVX2)
+            }
+
+#undef SC_SIMD_KERNELS
+
+            namespace detail{
+                /// Tabela de operações de T num conjunto de instruções (ex.: ops<sse2::i32, sse2::u8, ..., float>).
+                template <typename I32, typename U8, typename F32, typename F64, typename T>
+                using ops = typename std::conditional< std::is_same<T, std::int32_t>::value, I32,
+                            typename std::conditional< std::is_same<T, std::uint8_t>::value, U8,
+                            typename std::conditional< std::is_same<T, float>::value, F32, F64 >::type >::type >::type;
+
+                template <typename T> using sse2_ops = ops<sse2::i32, sse2::u8, sse2::f32, sse2::f64, T>;
+                template <typename T> using avx2_ops = ops<avx2::i32, avx2::u8, avx2::f32, avx2::f64, T>;
+            }
+#endif
+
+            /**
+            * @brief Conjunto de instruções escolhido para esta CPU.
+            */
+            enum class isa { scalar, sse2, avx2 };
+
+            /**
+            * @brief Retorna o conjunto de instruções usado pelos kernels (detectado uma única vez).
+            */
+            inline isa active_isa( void ){
+#if SC_SIMD_X86
+                static const isa detected = []{
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+                }();
+                return detected;
+#else
+                return isa::scalar;
+#endif
+            }
+
+// Encaminha a chamada para o kernel de T no conjunto de instruções ativo, ou para a versão escalar.
+#if SC_SIMD_X86
+    #define SC_SIMD_DISPATCH(T, CALL, ...)                                                       \
+                if constexpr (is_vectorizable<T>::value){                                        \
+                    if(active_isa() == isa::avx2)                                                \
+                        return avx2::CALL<detail::avx2_ops<T>>(__VA_ARGS__);                     \
+                    return sse2::CALL<detail::sse2_ops<T>>(__VA_ARGS__);                         \
+                }                                                                                \
+                return scalar::CALL(__VA_ARGS__)
+#else
+    #define SC_SIMD_DISPATCH(T, CALL, ...) return scalar::CALL(__VA_ARGS__)
+#endif
+
+            /**
+            * @brief Retorna true se os n elementos de a e b forem iguais (segundo ==).
+            * @param a     Primeiro bloco.
+            * @param b     Segundo bloco.
+            * @param n     Quantidade de elementos.
+            */
+            template <typename T>
+            bool equal( const T *a, const T *b, std::size_t n ){
+#if SC_SIMD_X86
+                // Inteiros não têm bits de preenchimento: iguais se e somente se os bytes forem iguais.
+                if constexpr (std::is_integral<T>::value and not is_vectorizable<T>::value){
+                    return equal(reinterpret_cast<const std::uint8_t *>(a), reinterpret_cast<const std::uint8_t *>(b), n * sizeof(T));
+                }
+#endif
+                SC_SIMD_DISPATCH(T, equal, a, b, n);
+            }
+            /**
+            * @brief Retorna o índice do primeiro elemento igual a value, ou n se não houver.
+            * @param p         Bloco.
+            * @param n         Quantidade de elementos.
+            * @param value     Valor procurado.
+            */
+            template <typename T>
+            std::size_t find( const T *p, std::size_t n, const T &value ){
+                SC_SIMD_DISPATCH(T, find, p, n, value);
+            }
+            /**
+            * @brief Retorna quantos elementos são iguais a value.
+            * @param p         Bloco.
+            * @param n         Quantidade de elementos.
+            * @param value     Valor procurado.
+            */
+            template <typename T>
+            std::size_t count( const T *p, std::size_t n, const T &value ){
+                SC_SIMD_DISPATCH(T, count, p, n, value);
+            }
+            /**
+            * @brief Retorna o menor elemento. O bloco não pode ser vazio.
+            * @param p     Bloco.
+            * @param n     Quantidade de elementos (n > 0).
+            */
+            template <typename T>
+            T min( const T *p, std::size_t n ){
+                SC_SIMD_DISPATCH(T, min, p, n);
+            }
+            /**
+            * @brief Retorna o maior elemento. O bloco não pode ser vazio.
+            * @param p     Bloco.
+            * @param n     Quantidade de elementos (n > 0).
+            */
+            template <typename T>
+            T max( const T *p, std::size_t n ){
+                SC_SIMD_DISPATCH(T, max, p, n);
+            }
+            /**
+            * @brief Retorna a soma dos elementos (ver sum_type).
+            * @param p     Bloco.
+            * @param n     Quantidade de elementos.
+            */
+            template <typename T>
+            sum_type<T> sum( const T *p, std::size_t n ){
+                SC_SIMD_DISPATCH(T, sum, p, n);
+            }
+
+#undef SC_SIMD_DISPATCH
+        }
+    }
+
+#endif
@@ -0,0 +1,314 @@
+/**
+ * @file slot_vector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Slot Vector (lista densa com identificadores estáveis e remoção O(1)) em C++
+*/
+
+#ifndef SLOT_VECTOR_H
+#define SLOT_VECTOR_H
+
+#include <cstdint>              // std::uint32_t
+#include <stdexcept>            // std::out_of_range, std::length_error
+#include <utility>              // std::move, std::forward
+
+#include "debug.h"
+#include "span.h"
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Identificador de um elemento de sc::slot_vector: a posição na tabela de slots e a geração do slot
+        * quando o elemento foi inserido. Continua válido enquanto o elemento existir, mesmo que outros sejam
+        * removidos ou a lista cresça; depois que o elemento é removido, deixa de ser aceito (a geração do slot muda),
+        * mesmo que o slot seja reaproveitado.
+        */
+        struct slot_handle {
+            std::uint32_t index = invalid_index; //!< Posição na tabela de slots.
+            std::uint32_t generation = 0; //!< Geração do slot no momento da inserção.
+
+            static constexpr std::uint32_t invalid_index = ~std::uint32_t(0);
+
+            bool operator==( const slot_handle &other ) const{
+                return index == other.index and generation == other.generation;
+            }
+            bool operator!=( const slot_handle &other ) const{
+                return not (*this == other);
+            }
+        };
+
+        /**
+        * @brief Lista cujos elementos ficam sempre contíguos (um sc::vector denso, sem buracos), com remoção O(1) por
+        * troca com o último elemento, e que entrega identificadores estáveis (slot_handle) em vez de índices. Uma
+        * tabela de slots liga cada identificador à posição atual do elemento; slots liberados formam uma lista livre
+        * e são reaproveitados por inserções seguintes, com a geração incrementada para que identificadores antigos
+        * sejam recusados.
+        *
+        *     sc::slot_vector<Entity> entities;
+        *     auto h = entities.insert(Entity{...});
+        *     for(auto &e : entities) update(e);     // varredura densa
+        *     entities.erase(h);                     // O(1); os outros identificadores continuam válidos
+        *
+        * A ordem da varredura muda a cada remoção. Ponteiros e referências para os elementos são invalidados por
+        * remoções e realocações; os identificadores, não.
+        * @tparam T     Tipo dos elementos.
+        */
+        template <typename T>
+        class slot_vector {
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using value_type = T; //!< The value type.
+            using handle = slot_handle; //!< Stable identifier of an element.
+            using reference = T&; //!< Reference to an element.
+            using const_reference = const T&; //!< Const reference to an element.
+            using iterator = typename vector<T>::iterator; //!< Iterator over the dense elements.
+            using const_iterator = typename vector<T>::const_iterator; //!< Const iterator over the dense elements.
+
+        private :
+            /// Entrada da tabela: a posição densa do elemento, ou o próximo slot livre se o slot estiver livre. A geração é
+            /// par enquanto o slot está ocupado e ímpar enquanto está livre: liberar e reaproveitar a incrementam.
+            struct slot {
+                std::uint32_t index;
+                std::uint32_t generation;
+            };
+
+            vector<T> m_values; //!< Elementos, contíguos.
+            vector<std::uint32_t> m_owners; //!< m_owners[i] é o slot do elemento m_values[i].
+            vector<slot> m_slots;
+            std::uint32_t m_free; //!< Primeiro slot da lista livre, ou invalid_index.
+
+            /**
+            * @brief Retorna o slot de h se h for um identificador vivo desta lista, ou nullptr.
+            * @param h     Identificador.
+            */
+            const slot * find_slot( handle h ) const{
+                if(h.index >= m_slots.size())
+                    return nullptr;
+                const slot &s = m_slots[h.index];
+                // Um slot livre (geração ímpar) guarda um índice da lista livre: nenhum identificador o aceita, nem um
+                // forjado ou vindo de outra lista com a mesma geração.
+                if(s.generation != h.generation or s.generation % 2 != 0 or s.index >= m_values.size())
+                    return nullptr;
+                return &s;
+            }
+            /**
+            * @brief Reserva um slot (da lista livre ou novo) para o elemento na posição densa pos.
+            * @param pos     Posição densa.
+            */
+            handle acquire_slot( std::uint32_t pos ){
+                if(m_free != handle::invalid_index){
+                    std::uint32_t index = m_free;
+                    slot &s = m_slots[index];
+                    m_free = s.index;
+                    s.index = pos;
+                    ++s.generation; // ímpar (livre) -> par (ocupado)
+                    return handle{ index, s.generation };
+                }
+                if(m_slots.size() >= handle::invalid_index)
+                    throw std::length_error("[slot_vector] Too many slots");
+                m_slots.push_back(slot{ pos, 0 });
+                return handle{ static_cast<std::uint32_t>(m_slots.size() - 1), 0 };
+            }
+            /**
+            * @brief Devolve o slot index à lista livre, invalidando os identificadores que apontam para ele.
+            * @param index     Slot.
+            */
+            void release_slot( std::uint32_t index ){
+                slot &s = m_slots[index];
+                ++s.generation; // par (ocupado) -> ímpar (livre)
+                s.index = m_free;
+                m_free = index;
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia. Nenhuma memória é alocada.
+            */
+            slot_vector( void )
+                : m_values()
+                , m_owners()
+                , m_slots()
+                , m_free(handle::invalid_index)
+            { }
+
+            /**
+            * @brief Retorna o número de elementos.
+            */
+            size_type size( void ) const{
+                return m_values.size();
+            }
+            /**
+            * @brief Retorna true se a lista estiver vazia.
+            */
+            bool empty( void ) const{
+                return m_values.empty();
+            }
+            /**
+            * @brief Retorna a capacidade do armazenamento denso.
+            */
+            size_type capacity( void ) const{
+                return m_values.capacity();
+            }
+            /**
+            * @brief Reserva espaço para n elementos (e seus slots).
+            * @param n     Capacidade desejada.
+            */
+            void reserve( size_type n ){
+                m_values.reserve(n);
+                m_owners.reserve(n);
+                m_slots.reserve(n);
+            }
+
+            /**
+            * @brief Constrói um elemento no fim do armazenamento denso e retorna seu identificador.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            handle emplace( Args&&... args ){
+                std::uint32_t pos = static_cast<std::uint32_t>(m_values.size());
+                handle h = acquire_slot(pos);
+                try {
+                    m_owners.push_back(h.index);
+                } catch(...) {
+                    release_slot(h.index);
+                    throw;
+                }
+                try {
+                    m_values.emplace_back(std::forward<Args>(args)...);
+                } catch(...) {
+                    m_owners.pop_back();
+                    release_slot(h.index);
+                    throw;
+                }
+                return h;
+            }
+            /**
+            * @brief Insere uma cópia de value e retorna seu identificador.
+            * @param value     Valor.
+            */
+            handle insert( const T &value ){
+                return emplace(value);
+            }
+            /**
+            * @brief Insere value, movendo-o, e retorna seu identificador.
+            * @param value     Valor.
+            */
+            handle insert( T &&value ){
+                return emplace(std::move(value));
+            }
+            /**
+            * @brief Remove o elemento de h em O(1): o último elemento denso é movido para o lugar dele. Retorna false
+            * (sem fazer nada) se h não for um identificador vivo.
+            * @param h     Identificador.
+            */
+            bool erase( handle h ){
+                const slot *s = find_slot(h);
+                if(s == nullptr)
+                    return false;
+                std::uint32_t pos = s->index;
+                std::uint32_t last = static_cast<std::uint32_t>(m_values.size() - 1);
+                if(pos != last){
+                    m_values[pos] = std::move(m_values[last]);
+                    m_owners[pos] = m_owners[last];
+                    m_slots[m_owners[pos]].index = pos;
+                }
+                m_values.pop_back();
+                m_owners.pop_back();
+                release_slot(h.index);
+                return true;
+            }
+            /**
+            * @brief Remove todos os elementos. Todos os identificadores entregues deixam de ser válidos.
+            */
+            void clear( void ){
+                for(std::uint32_t index : m_owners)
+                    release_slot(index);
+                m_values.clear();
+                m_owners.clear();
+            }
+
+            /**
+            * @brief Retorna true se h identifica um elemento desta lista.
+            * @param h     Identificador.
+            */
+            bool contains( handle h ) const{
+                return find_slot(h) != nullptr;
+            }
+            /**
+            * @brief Retorna um ponteiro para o elemento de h, ou nullptr se h não for válido.
+            * @param h     Identificador.
+            */
+            T * get( handle h ){
+                const slot *s = find_slot(h);
+                return s == nullptr ? nullptr : &m_values[s->index];
+            }
+            const T * get( handle h ) const{
+                const slot *s = find_slot(h);
+                return s == nullptr ? nullptr : &m_values[s->index];
+            }
+            /**
+            * @brief Retorna o elemento de h. Se h não for válido, uma exceção do tipo std::out_of_range é lançada.
+            * @param h     Identificador.
+            */
+            reference at( handle h ){
+                T *p = get(h);
+                if(p == nullptr)
+                    throw std::out_of_range("[at()] Stale or invalid slot_vector handle");
+                return *p;
+            }
+            const_reference at( handle h ) const{
+                const T *p = get(h);
+                if(p == nullptr)
+                    throw std::out_of_range("[at()] Stale or invalid slot_vector handle");
+                return *p;
+            }
+            /**
+            * @brief Retorna o elemento de h, sem verificar a geração (verificada no modo de depuração, ver debug.h).
+            * @param h     Identificador.
+            */
+            reference operator[]( handle h ){
+                SC_DEBUG_CHECK(find_slot(h) != nullptr, "slot_vector::operator[] with a stale handle");
+                return m_values[m_slots[h.index].index];
+            }
+            const_reference operator[]( handle h ) const{
+                SC_DEBUG_CHECK(find_slot(h) != nullptr, "slot_vector::operator[] with a stale handle");
+                return m_values[m_slots[h.index].index];
+            }
+            /**
+            * @brief Retorna o identificador do elemento na posição densa pos (ex.: durante uma varredura).
+            * @param pos     Posição densa.
+            */
+            handle handle_at( size_type pos ) const{
+                std::uint32_t index = m_owners.at(pos);
+                return handle{ index, m_slots[index].generation };
+            }
+
+            /**
+            * @brief Retorna os elementos como um span contíguo, na ordem densa atual.
+            */
+            span<T> values( void ){
+                return span<T>(m_values);
+            }
+            span<const T> values( void ) const{
+                return span<const T>(m_values);
+            }
+            /**
+            * @brief Retorna um ponteiro para o primeiro elemento denso.
+            */
+            T * data( void ){
+                return m_values.data();
+            }
+            const T * data( void ) const{
+                return m_values.data();
+            }
+            iterator begin( void ){ return m_values.begin(); }
+            iterator end( void ){ return m_values.end(); }
+            const_iterator begin( void ) const{ return m_values.cbegin(); }
+            const_iterator end( void ) const{ return m_values.cend(); }
+            const_iterator cbegin( void ) const{ return m_values.cbegin(); }
+            const_iterator cend( void ) const{ return m_values.cend(); }
+        };
+    }
+
+#endif
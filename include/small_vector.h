@@ -0,0 +1,252 @@
+/**
+ * @file small_vector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Small Vector (sc::vector com buffer interno) em C++
+*/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief sc::vector que guarda até N elementos dentro do próprio objeto, sem alocar. Só ao passar de N elementos
+        * os dados são transferidos para um bloco obtido do alocador, seguindo a GrowthPolicy. A interface é a de sc::vector.
+        *
+        * A herança é protegida: uma small_vector não pode ser vista como sc::vector&, porque o buffer interno não pode
+        * ser tomado por outra lista: movê-lo para um sc::vector comum aloca, o que as operações noexcept de sc::vector
+        * não podem fazer. Entre small_vector, mover e trocar nunca alocam. Para funções que recebem
+        * const sc::vector& (sc::find, sc::sum, serialize, ...), use as_vector().
+        * @tparam T               Tipo dos elementos.
+        * @tparam N               Quantidade de elementos guardados no buffer interno.
+        * @tparam Allocator       Alocador usado depois que o buffer interno se esgota.
+        * @tparam GrowthPolicy    Regra de crescimento da capacidade (ver growth.h).
+        */
+        template <typename T, std::size_t N, typename Allocator = std::allocator<T>, typename GrowthPolicy = growth::default_policy >
+        class small_vector : protected vector<T, Allocator, GrowthPolicy> {
+            static_assert(N > 0, "small_vector needs an inline capacity of at least one element");
+
+            friend class vector<T, Allocator, GrowthPolicy>; // vector( small_vector && ) move a lista como base
+
+        public :
+            using base_type = vector<T, Allocator, GrowthPolicy>; //!< The underlying vector type.
+            using size_type = typename base_type::size_type; //!< The size type.
+            using value_type = typename base_type::value_type; //!< The value type.
+            using allocator_type = typename base_type::allocator_type; //!< The allocator type.
+            using growth_policy = typename base_type::growth_policy; //!< The capacity growth policy.
+            using pointer = typename base_type::pointer; //!< Pointer to a value stored in the container.
+            using reference = typename base_type::reference; //!< Reference to a value stored in the container.
+            using const_reference = typename base_type::const_reference; //!< Const reference to a value stored in the container.
+            using iterator = typename base_type::iterator; //!< Iterator over the elements.
+            using const_iterator = typename base_type::const_iterator; //!< Const iterator over the elements.
+
+            static constexpr size_type inline_capacity = N; //!< Elements stored without touching the allocator.
+
+            // A interface de sc::vector, exceto swap() (ver small_vector::swap) e as comparações (entre small_vector).
+            using base_type::get_allocator;
+            using base_type::full;
+            using base_type::size;
+            using base_type::clear;
+            using base_type::empty;
+            using base_type::push_front;
+            using base_type::emplace_front;
+            using base_type::push_back;
+            using base_type::emplace_back;
+            using base_type::append_range;
+            using base_type::append;
+            using base_type::resize;
+            using base_type::resize_for_overwrite;
+            using base_type::pop_back;
+            using base_type::pop_front;
+            using base_type::back;
+            using base_type::front;
+            using base_type::assign;
+            using base_type::operator[];
+            using base_type::at;
+            using base_type::capacity;
+            using base_type::reserve;
+            using base_type::shrink_to_fit;
+            using base_type::trim;
+            using base_type::begin;
+            using base_type::cbegin;
+            using base_type::end;
+            using base_type::cend;
+            using base_type::insert;
+            using base_type::emplace;
+            using base_type::erase;
+            using base_type::data;
+            using base_type::print;
+
+        private :
+            using alloc_traits = std::allocator_traits<Allocator>;
+
+            // Os construtores passam o buffer à base antes que small_vector esteja construído; por isso ele é
+            // referenciado diretamente (reinterpret_cast<pointer>(m_buffer)), sem chamar funções membro.
+            alignas(T) unsigned char m_buffer[N * sizeof(T)]; //!< Buffer interno (memória bruta).
+
+        protected :
+            /**
+            * @brief O buffer interno não pertence ao alocador.
+            * @param p     Bloco consultado.
+            */
+            bool is_external( const value_type *p ) const override{
+                return p == reinterpret_cast<const value_type *>(m_buffer);
+            }
+            /**
+            * @brief Depois que outra lista tomou o bloco do alocador, volta ao buffer interno, para que a lista movida não precise alocar ao crescer de novo.
+            */
+            void restore_buffer( void ) override{
+                this->use_buffer(reinterpret_cast<pointer>(m_buffer), N);
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia que usa o buffer interno. Nenhuma memória é alocada.
+            */
+            small_vector()
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, Allocator())
+            { }
+            /**
+            * @brief Cria uma lista vazia que usa o buffer interno e, quando ele se esgotar, o alocador dado.
+            * @param alloc     Alocador.
+            */
+            explicit small_vector( const Allocator &alloc )
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, alloc)
+            { }
+            /**
+            * @brief Cria uma lista vazia com capacidade para pelo menos size_ elementos.
+            * @param size_       Capacidade desejada.
+            * @param alloc       Alocador.
+            */
+            explicit small_vector( size_type size_, const Allocator &alloc = Allocator() )
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, alloc)
+            {
+                this->reserve(size_);
+            }
+            /**
+            * @brief Constrói a lista com o conteúdo do intervalo first, last.
+            * @param first      Inicio do intevalo.
+            * @param last       Fim do intervalo.
+            * @param alloc      Alocador.
+            */
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
+            small_vector( InputIt first, InputIt last, const Allocator &alloc = Allocator() )
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, alloc)
+            {
+                this->assign(first, last);
+            }
+            /**
+            * @brief Constrói a lista com o conteúdo da lista de inicializadores.
+            * @param list     Lista de inicializadores.
+            * @param alloc    Alocador.
+            */
+            small_vector( std::initializer_list<T> list, const Allocator &alloc = Allocator() )
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, alloc)
+            {
+                this->assign(list);
+            }
+            /**
+            * @brief Um construtor de cópia. O alocador vem de select_on_container_copy_construction, como em sc::vector.
+            * @param other      Onde será copiada a lista.
+            */
+            small_vector( const small_vector &other )
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, alloc_traits::select_on_container_copy_construction(other.get_allocator()))
+            {
+                base_type::operator=(other);
+            }
+            /**
+            * @brief Um construtor de movimento. Se other estiver usando o buffer interno, os elementos são movidos um a um para o buffer interno desta lista, que tem o mesmo tamanho; caso contrário, o bloco de other é tomado em O(1) e other volta ao seu buffer interno. Nada é alocado.
+            * @param other      Lista a ser movida.
+            */
+            small_vector( small_vector &&other ) noexcept(std::is_nothrow_move_constructible<T>::value)
+                : base_type(reinterpret_cast<pointer>(m_buffer), N, other.get_allocator())
+            {
+                base_type::operator=(std::move(other));
+            }
+            /**
+            * @brief Destrói a lista. Se os elementos estiverem no buffer interno, são destruídos aqui, enquanto o buffer ainda existe.
+            */
+            ~small_vector( void ){
+                this->release_external();
+            }
+            /**
+            * @brief Copiar operador de atribuição.
+            * @param other     O que será copiado
+            */
+            small_vector& operator =( const small_vector &other ){
+                base_type::operator=(other);
+                return *this;
+            }
+            /**
+            * @brief Operador de atribuição por movimento. Se other estiver usando o buffer interno, esta lista volta ao seu próprio buffer interno (liberando o bloco do alocador) e os elementos são movidos um a um, sem alocar.
+            * @param other     O que será movido
+            */
+            small_vector& operator =( small_vector &&other ) noexcept(std::is_nothrow_move_constructible<T>::value
+                                                                      and (alloc_traits::propagate_on_container_move_assignment::value
+                                                                           or alloc_traits::is_always_equal::value)){
+                if(other.is_small() and not is_small())
+                    this->use_buffer(reinterpret_cast<pointer>(m_buffer), N);
+                base_type::operator=(std::move(other));
+                return *this;
+            }
+            /**
+            * @brief Substitui o conteúdo por aqueles identificados pela lista de inicializadores.
+            * @param list     Lista de inicializadores.
+            */
+            small_vector& operator =( std::initializer_list<T> list ){
+                this->assign(list);
+                return *this;
+            }
+            /**
+            * @brief Troca o conteúdo com o de other sem alocar. Se as duas listas usam blocos do alocador, a troca é O(1);
+            * se as duas usam o buffer interno, os elementos são trocados um a um; se só uma usa, os elementos dela são
+            * movidos para o buffer interno da outra, que lhe entrega o bloco do alocador.
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap( small_vector &other ) noexcept(std::is_nothrow_move_constructible<T>::value
+                                                      and std::is_nothrow_swappable<T>::value){
+                this->swap_storage(other);
+            }
+            /**
+            * @brief Verifica se o conteúdo é igual ao de outra lista.
+            * @param other     Lista.
+            */
+            bool operator==( const small_vector &other ) const{
+                return base_type::operator==(other);
+            }
+            /**
+            * @brief Verifica se o conteúdo é diferente do de outra lista.
+            * @param other     Lista.
+            */
+            bool operator!=( const small_vector &other ) const{
+                return base_type::operator!=(other);
+            }
+            /**
+            * @brief Retorna a lista vista como const sc::vector&, para funções que só a leem (sc::find, sc::sum,
+            * serialize, sc::span, cópia para um sc::vector...). Não há versão mutável: ver a descrição da classe.
+            */
+            const base_type & as_vector( void ) const{
+                return *this;
+            }
+            /**
+            * @brief Retorna true enquanto os elementos estiverem no buffer interno (nenhuma alocação feita).
+            */
+            bool is_small( void ) const{
+                return is_external(this->data());
+            }
+        };
+
+        /**
+        * @brief Troca o conteúdo de duas small_vector (ver small_vector::swap).
+        * @param lhs     Primeira lista.
+        * @param rhs     Segunda lista.
+        */
+        template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+        void swap( small_vector<T, N, Allocator, GrowthPolicy> &lhs, small_vector<T, N, Allocator, GrowthPolicy> &rhs ) noexcept(noexcept(lhs.swap(rhs))){
+            lhs.swap(rhs);
+        }
+    }
+
+#endif
@@ -0,0 +1,541 @@
+/**
+ * @file soa_vector.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe SoA Vector (lista com uma coluna contígua por campo) em C++
+*/
+
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include <cstddef>              // std::size_t
+#include <memory>               // std::allocator, std::allocator_traits
+#include <stdexcept>            // std::out_of_range
+#include <tuple>                // std::tuple, std::get, std::tuple_element
+#include <type_traits>          // std::is_nothrow_move_constructible
+#include <utility>              // std::index_sequence, std::forward, std::move
+
+#include "span.h"
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Lista de linhas (Ts...) guardada como uma estrutura de arrays: cada campo tem sua própria coluna
+        * contígua, e todas as colunas compartilham tamanho e capacidade. Laços que usam só alguns campos leem só as
+        * colunas deles (column<K>() devolve um sc::span), o que aproveita cada linha de cache e permite vetorização.
+        * O acesso por linha devolve uma tupla de referências (row), que funciona com std::get e structured bindings:
+        *
+        *     sc::soa_vector<float, float, int> particles;
+        *     particles.push_back({ 1.0f, 2.0f, 7 });
+        *     auto [x, y, id] = particles[0];     // referências para os campos da linha 0
+        *     for(float &v : particles.column<0>()) v *= 2;
+        *
+        * O crescimento segue a GrowthPolicy (com o tamanho da linha inteira como tamanho do elemento) e move cada
+        * coluna com a mesma transferência usada por sc::vector. Os campos precisam ser nothrow move constructible,
+        * para que uma realocação nunca fique pela metade.
+        * @tparam GrowthPolicy    Regra de crescimento da capacidade (ver growth.h).
+        * @tparam Allocator       Alocador, reassociado (rebind) ao tipo de cada coluna.
+        * @tparam Ts              Tipos dos campos.
+        */
+        template <typename GrowthPolicy, typename Allocator, typename... Ts>
+        class basic_soa_vector {
+            static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+            static_assert((std::is_nothrow_move_constructible<Ts>::value and ...), "soa_vector fields must be nothrow move constructible");
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using value_type = std::tuple<Ts...>; //!< A row, by value.
+            using allocator_type = Allocator; //!< The allocator type.
+            using growth_policy = GrowthPolicy; //!< The capacity growth policy.
+            using row = std::tuple<Ts&...>; //!< Proxy reference to a row.
+            using const_row = std::tuple<const Ts&...>; //!< Proxy const reference to a row.
+
+            template <std::size_t K>
+            using field_type = typename std::tuple_element<K, value_type>::type; //!< Type of the K-th field.
+
+            static constexpr std::size_t fields = sizeof...(Ts); //!< Number of columns.
+
+        private :
+            template <typename U>
+            using rebind = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+            using indices = std::index_sequence_for<Ts...>;
+
+            std::tuple<Ts*...> m_columns; //!< Memória bruta de cada coluna: apenas [0, m_end) contém objetos construídos.
+            size_type m_end;
+            size_type m_capacity;
+            Allocator m_alloc;
+
+            /**
+            * @brief Obtém memória bruta para n elementos do tipo U.
+            * @param n     Quantidade de posições.
+            */
+            template <typename U>
+            U * allocate_column( size_type n ){
+                rebind<U> alloc(m_alloc);
+                return n == 0 ? nullptr : std::allocator_traits<rebind<U>>::allocate(alloc, n);
+            }
+            /**
+            * @brief Devolve ao alocador uma coluna obtida com allocate_column().
+            * @param p     Coluna.
+            * @param n     Quantidade de posições.
+            */
+            template <typename U>
+            void deallocate_column( U *p, size_type n ){
+                rebind<U> alloc(m_alloc);
+                if(p != nullptr)
+                    std::allocator_traits<rebind<U>>::deallocate(alloc, p, n);
+            }
+            /**
+            * @brief Destrói as linhas [first, last) de todas as colunas.
+            */
+            template <std::size_t... I>
+            void destroy_rows( size_type first, size_type last, std::index_sequence<I...> ){
+                (destroy_column(std::get<I>(m_columns) + first, std::get<I>(m_columns) + last), ...);
+            }
+            template <typename U>
+            void destroy_column( U *first, U *last ){
+                rebind<U> alloc(m_alloc);
+                detail::destroy(alloc, first, last);
+            }
+            /**
+            * @brief Libera todas as colunas (sem destruir objetos).
+            */
+            template <std::size_t... I>
+            void deallocate_all( std::tuple<Ts*...> &columns, size_type n, std::index_sequence<I...> ){
+                (deallocate_column(std::get<I>(columns), n), ...);
+            }
+            /**
+            * @brief Aloca new_cap posições para cada coluna. Se alguma alocação falhar, as anteriores são liberadas.
+            * @param new_cap     Capacidade das colunas.
+            */
+            template <std::size_t... I>
+            std::tuple<Ts*...> allocate_all( size_type new_cap, std::index_sequence<I...> ){
+                std::tuple<Ts*...> columns{ static_cast<Ts*>(nullptr)... };
+                try {
+                    ((std::get<I>(columns) = allocate_column<Ts>(new_cap)), ...);
+                } catch(...) {
+                    deallocate_all(columns, new_cap, indices());
+                    throw;
+                }
+                return columns;
+            }
+            /**
+            * @brief Transfere as linhas de todas as colunas para columns com detail::relocate (um memcpy para campos
+            * trivialmente copiáveis). Não lança exceções, pois os campos são nothrow move constructible.
+            * @param columns     Colunas novas.
+            */
+            template <std::size_t... I>
+            void relocate_all( std::tuple<Ts*...> &columns, std::index_sequence<I...> ){
+                relocate_rows(m_columns, m_end, columns, indices());
+            }
+            /**
+            * @brief Transfere as n primeiras linhas de source para columns, com o alocador desta lista.
+            * @param source      Colunas de origem; ao final, não contêm mais objetos vivos.
+            * @param n           Quantidade de linhas.
+            * @param columns     Colunas de destino (memória bruta).
+            */
+            template <std::size_t... I>
+            void relocate_rows( std::tuple<Ts*...> &source, size_type n, std::tuple<Ts*...> &columns, std::index_sequence<I...> ){
+                (relocate_column(std::get<I>(source), n, std::get<I>(columns)), ...);
+            }
+            /**
+            * @brief Único ponto de realocação: aloca new_cap posições por coluna, transfere as linhas e libera as colunas antigas.
+            * @param new_cap     Nova capacidade.
+            */
+            void reallocate( size_type new_cap ){
+                std::tuple<Ts*...> columns = allocate_all(new_cap, indices());
+                relocate_all(columns, indices());
+                deallocate_all(m_columns, m_capacity, indices());
+                m_columns = columns;
+                m_capacity = new_cap;
+            }
+            template <typename U>
+            void relocate_column( U *source, size_type n, U *dest ){
+                rebind<U> alloc(m_alloc);
+                detail::relocate(alloc, source, n, dest);
+            }
+            /**
+            * @brief Retorna a capacidade usada no próximo crescimento, segundo a GrowthPolicy.
+            * @param required     Quantidade mínima de posições necessária.
+            */
+            size_type next_capacity( size_type required ) const{
+                return GrowthPolicy::next_capacity(m_capacity, required, (sizeof(Ts) + ...));
+            }
+            /**
+            * @brief Constrói o campo K (e os seguintes) da linha pos de columns a partir da tupla values. Se a
+            * construção de um campo lançar exceção, os campos já construídos da linha são destruídos.
+            * @param columns     Colunas.
+            * @param pos         Posição da linha.
+            * @param values      Valores dos campos.
+            */
+            template <std::size_t K, typename Tuple>
+            void construct_row( std::tuple<Ts*...> &columns, size_type pos, Tuple &&values ){
+                if constexpr (K < fields){
+                    using U = field_type<K>;
+                    rebind<U> alloc(m_alloc);
+                    U *slot = std::get<K>(columns) + pos;
+                    std::allocator_traits<rebind<U>>::construct(alloc, slot, std::get<K>(std::forward<Tuple>(values)));
+                    try {
+                        construct_row<K + 1>(columns, pos, std::forward<Tuple>(values));
+                    } catch(...) {
+                        std::allocator_traits<rebind<U>>::destroy(alloc, slot);
+                        throw;
+                    }
+                }
+            }
+            /**
+            * @brief Copia as linhas de other para colunas recém-alocadas (capacidade igual ao tamanho de other).
+            */
+            template <std::size_t... I>
+            void copy_from( const basic_soa_vector &other, std::index_sequence<I...> ){
+                m_columns = allocate_all(other.m_end, indices());
+                m_capacity = other.m_end;
+                std::size_t built = 0;
+                try {
+                    ((copy_column(std::get<I>(other.m_columns), other.m_end, std::get<I>(m_columns)), ++built), ...);
+                } catch(...) {
+                    // Destrói as colunas completas; a que falhou já se desfez em construct_range.
+                    std::size_t k = 0;
+                    ((k++ < built ? destroy_column(std::get<I>(m_columns), std::get<I>(m_columns) + other.m_end) : void()), ...);
+                    deallocate_all(m_columns, m_capacity, indices());
+                    m_columns = std::tuple<Ts*...>();
+                    m_capacity = 0;
+                    throw;
+                }
+                m_end = other.m_end;
+            }
+            /**
+            * @brief Destrói as linhas e libera as colunas, deixando a lista vazia e sem capacidade.
+            */
+            void release( void ){
+                destroy_rows(0, m_end, indices());
+                deallocate_all(m_columns, m_capacity, indices());
+                m_columns = std::tuple<Ts*...>();
+                m_end = 0;
+                m_capacity = 0;
+            }
+            template <typename U>
+            void copy_column( const U *source, size_type n, U *dest ){
+                rebind<U> alloc(m_alloc);
+                if constexpr (std::is_trivially_copyable<U>::value)
+                    detail::copy_n<detail::parallel_first_touch<Allocator>::value>(source, n, dest);
+                else
+                    detail::construct_range(alloc, source, source + n, dest);
+            }
+            template <std::size_t... I>
+            row make_row( size_type pos, std::index_sequence<I...> ){
+                return row(std::get<I>(m_columns)[pos]...);
+            }
+            template <std::size_t... I>
+            const_row make_row( size_type pos, std::index_sequence<I...> ) const{
+                return const_row(std::get<I>(m_columns)[pos]...);
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia. Nenhuma memória é alocada.
+            */
+            basic_soa_vector()
+                : m_columns()
+                , m_end(0)
+                , m_capacity(0)
+                , m_alloc()
+            { }
+            /**
+            * @brief Cria uma lista vazia que usa o alocador dado.
+            * @param alloc     Alocador.
+            */
+            explicit basic_soa_vector( const Allocator &alloc )
+                : m_columns()
+                , m_end(0)
+                , m_capacity(0)
+                , m_alloc(alloc)
+            { }
+            /**
+            * @brief Um construtor de cópia. Cada coluna é copiada em bloco quando o campo é trivialmente copiável.
+            * @param other      Onde será copiada a lista.
+            */
+            basic_soa_vector( const basic_soa_vector &other )
+                : m_columns()
+                , m_end(0)
+                , m_capacity(0)
+                , m_alloc(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_alloc))
+            {
+                copy_from(other, indices());
+            }
+            /**
+            * @brief Um construtor de movimento. Toma posse das colunas de other em O(1).
+            * @param other      Lista cujas colunas serão tomadas.
+            */
+            basic_soa_vector( basic_soa_vector &&other ) noexcept
+                : m_columns(other.m_columns)
+                , m_end(other.m_end)
+                , m_capacity(other.m_capacity)
+                , m_alloc(std::move(other.m_alloc))
+            {
+                other.m_columns = std::tuple<Ts*...>();
+                other.m_end = 0;
+                other.m_capacity = 0;
+            }
+            /**
+            * @brief Copiar operador de atribuição. O alocador de other só é copiado se propagate_on_container_copy_assignment permitir. Se a cópia lançar exceção, a lista não muda.
+            * @param other     O que será copiado.
+            */
+            basic_soa_vector& operator =( const basic_soa_vector &other ){
+                if(this == &other)
+                    return *this;
+
+                if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value){
+                    if(m_alloc != other.m_alloc)
+                        release(); // as colunas atuais só podem ser liberadas pelo alocador antigo
+                    m_alloc = other.m_alloc;
+                }
+                basic_soa_vector copy(m_alloc);
+                copy.copy_from(other, indices());
+                release();
+                m_columns = copy.m_columns;
+                m_end = copy.m_end;
+                m_capacity = copy.m_capacity;
+                copy.m_columns = std::tuple<Ts*...>();
+                copy.m_end = 0;
+                copy.m_capacity = 0;
+                return *this;
+            }
+            /**
+            * @brief Operador de atribuição por movimento. Toma posse das colunas de other em O(1), deixando-o vazio e sem capacidade. Se o alocador não se propaga e os alocadores diferem, as linhas são transferidas para colunas deste alocador.
+            * @param other     O que será movido.
+            */
+            basic_soa_vector& operator =( basic_soa_vector &&other ) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+                                                                              or std::allocator_traits<Allocator>::is_always_equal::value){
+                if(this == &other)
+                    return *this;
+
+                using traits = std::allocator_traits<Allocator>;
+                if constexpr (not traits::propagate_on_container_move_assignment::value and not traits::is_always_equal::value){
+                    if(m_alloc != other.m_alloc){
+                        std::tuple<Ts*...> columns = allocate_all(other.m_end, indices());
+                        release();
+                        relocate_rows(other.m_columns, other.m_end, columns, indices());
+                        m_columns = columns;
+                        m_end = m_capacity = other.m_end;
+                        other.m_end = 0;
+                        return *this;
+                    }
+                }
+                release();
+                if constexpr (traits::propagate_on_container_move_assignment::value)
+                    m_alloc = std::move(other.m_alloc);
+                m_columns = other.m_columns;
+                m_end = other.m_end;
+                m_capacity = other.m_capacity;
+                other.m_columns = std::tuple<Ts*...>();
+                other.m_end = 0;
+                other.m_capacity = 0;
+                return *this;
+            }
+            /**
+            * @brief Destrói a lista e libera as colunas.
+            */
+            ~basic_soa_vector( void ){
+                destroy_rows(0, m_end, indices());
+                deallocate_all(m_columns, m_capacity, indices());
+            }
+            /**
+            * @brief Troca o conteúdo com o de other em O(1). Se o alocador não se propaga na troca, os alocadores das duas listas devem ser iguais.
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap( basic_soa_vector &other ) noexcept{
+                using std::swap;
+                if constexpr (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+                    swap(m_alloc, other.m_alloc);
+                swap(m_columns, other.m_columns);
+                swap(m_end, other.m_end);
+                swap(m_capacity, other.m_capacity);
+            }
+
+            /**
+            * @brief Retorna o número de linhas.
+            */
+            size_type size( void ) const{
+                return m_end;
+            }
+            /**
+            * @brief Retorna true se a lista não contiver nenhuma linha.
+            */
+            bool empty( void ) const{
+                return m_end == 0;
+            }
+            /**
+            * @brief Retorna quantas linhas cabem nas colunas sem realocar.
+            */
+            size_type capacity( void ) const{
+                return m_capacity;
+            }
+            /**
+            * @brief Aumenta a capacidade de todas as colunas para new_cap.
+            * @param new_cap     Nova capacidade.
+            */
+            void reserve( size_type new_cap ){
+                if(new_cap > m_capacity)
+                    reallocate(new_cap);
+            }
+            /**
+            * @brief Realoca as colunas para caberem exatamente as linhas atuais.
+            */
+            void shrink_to_fit( void ){
+                if(m_end < m_capacity)
+                    reallocate(m_end);
+            }
+            /**
+            * @brief Remove todas as linhas. A capacidade não é alterada.
+            */
+            void clear( void ){
+                destroy_rows(0, m_end, indices());
+                m_end = 0;
+            }
+            /**
+            * @brief Constrói uma linha no final a partir de um valor para cada campo.
+            * @param values     Valores dos campos, na ordem de Ts.
+            */
+            template <typename... Us>
+            row emplace_back( Us&&... values ){
+                static_assert(sizeof...(Us) == fields, "emplace_back needs one value per field");
+                if(m_end == m_capacity){
+                    size_type new_cap = next_capacity(m_end + 1);
+                    std::tuple<Ts*...> columns = allocate_all(new_cap, indices());
+                    // Constrói a linha nova nas colunas novas antes de transferir as antigas: values podem referenciar uma linha existente.
+                    try {
+                        construct_row<0>(columns, m_end, std::forward_as_tuple(std::forward<Us>(values)...));
+                    } catch(...) {
+                        deallocate_all(columns, new_cap, indices());
+                        throw;
+                    }
+                    relocate_all(columns, indices());
+                    deallocate_all(m_columns, m_capacity, indices());
+                    m_columns = columns;
+                    m_capacity = new_cap;
+                } else
+                    construct_row<0>(m_columns, m_end, std::forward_as_tuple(std::forward<Us>(values)...));
+                ++m_end;
+                return back();
+            }
+            /**
+            * @brief Adiciona uma cópia da linha ao final.
+            * @param value     Linha.
+            */
+            void push_back( const value_type &value ){
+                std::apply([this]( const Ts&... fields_ ){ emplace_back(fields_...); }, value);
+            }
+            /**
+            * @brief Move a linha para o final.
+            * @param value     Linha.
+            */
+            void push_back( value_type &&value ){
+                std::apply([this]( Ts&... fields_ ){ emplace_back(std::move(fields_)...); }, value);
+            }
+            /**
+            * @brief Remove a última linha.
+            */
+            void pop_back( void ){
+                destroy_rows(m_end - 1, m_end, indices());
+                --m_end;
+            }
+
+            /**
+            * @brief Retorna as referências para os campos da linha pos, sem verificação de limites.
+            * @param pos     Posição da linha.
+            */
+            row operator[]( size_type pos ){
+                return make_row(pos, indices());
+            }
+            /**
+            * @brief Retorna as referências constantes para os campos da linha pos, sem verificação de limites.
+            * @param pos     Posição da linha.
+            */
+            const_row operator[]( size_type pos ) const{
+                return make_row(pos, indices());
+            }
+            /**
+            * @brief Retorna a linha pos. Se pos não estiver dentro da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição da linha.
+            */
+            row at( size_type pos ){
+                if(pos >= m_end)
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return make_row(pos, indices());
+            }
+            /**
+            * @brief Retorna a linha pos. Se pos não estiver dentro da lista, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição da linha.
+            */
+            const_row at( size_type pos ) const{
+                if(pos >= m_end)
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return make_row(pos, indices());
+            }
+            /**
+            * @brief Retorna a primeira linha.
+            */
+            row front( void ){
+                return make_row(0, indices());
+            }
+            /**
+            * @brief Retorna a última linha.
+            */
+            row back( void ){
+                return make_row(m_end - 1, indices());
+            }
+            /**
+            * @brief Retorna a coluna do campo K como um span (contígua, com size() elementos).
+            */
+            template <std::size_t K>
+            span<field_type<K>> column( void ){
+                return span<field_type<K>>(std::get<K>(m_columns), m_end);
+            }
+            /**
+            * @brief Retorna a coluna do campo K como um span somente leitura.
+            */
+            template <std::size_t K>
+            span<const field_type<K>> column( void ) const{
+                return span<const field_type<K>>(std::get<K>(m_columns), m_end);
+            }
+            /**
+            * @brief Retorna um ponteiro para o início da coluna do campo K.
+            */
+            template <std::size_t K>
+            field_type<K> * data( void ){
+                return std::get<K>(m_columns);
+            }
+            /**
+            * @brief Retorna um ponteiro constante para o início da coluna do campo K.
+            */
+            template <std::size_t K>
+            const field_type<K> * data( void ) const{
+                return std::get<K>(m_columns);
+            }
+            /**
+            * @brief Retorna uma cópia do alocador.
+            */
+            allocator_type get_allocator( void ) const{
+                return m_alloc;
+            }
+        };
+
+        /**
+        * @brief Troca o conteúdo de duas listas em O(1).
+        * @param lhs     Primeira lista.
+        * @param rhs     Segunda lista.
+        */
+        template <typename GrowthPolicy, typename Allocator, typename... Ts>
+        void swap( basic_soa_vector<GrowthPolicy, Allocator, Ts...> &lhs, basic_soa_vector<GrowthPolicy, Allocator, Ts...> &rhs ) noexcept{
+            lhs.swap(rhs);
+        }
+
+        /**
+        * @brief sc::basic_soa_vector com a política de crescimento e o alocador padrão.
+        */
+        template <typename... Ts>
+        using soa_vector = basic_soa_vector<growth::default_policy, std::allocator<char>, Ts...>;
+    }
+
+#endif
@@ -0,0 +1,229 @@
+/**
+ * @file span.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Implementação da classe Span (visão não proprietária de elementos contíguos) em C++
+*/
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cstddef>              // std::size_t
+#include <stdexcept>            // std::out_of_range
+#include <type_traits>          // std::is_convertible, std::enable_if
+
+#include "vector.h"
+
+    namespace sc{
+        /**
+        * @brief Visão de uma sequência contígua de elementos que pertence a outro container (sc::vector, array, bloco
+        * de memória). Copiar um span, ou fatiá-lo com first(), last() e subspan(), custa O(1) e não copia elementos,
+        * de modo que pedaços de uma lista podem ser entregues a várias threads. O span fica inválido quando a lista de
+        * origem realoca ou é destruída.
+        *
+        *     sc::span<int> all(vec);
+        *     worker(all.subspan(0, half));
+        *     worker(all.subspan(half));
+        *
+        * @tparam T     Tipo dos elementos (const T para uma visão somente leitura).
+        */
+        template <typename T>
+        class span {
+
+        public :
+            using size_type = unsigned long; //!< The size type.
+            using element_type = T; //!< The element type (may be const).
+            using value_type = typename std::remove_cv<T>::type; //!< The value type.
+            using pointer = T*; //!< Pointer to an element.
+            using reference = T&; //!< Reference to an element.
+            using iterator = MyIterator< T >; // See Code 3
+
+            static constexpr size_type npos = static_cast<size_type>(-1); //!< "Até o fim", em subspan().
+
+        private :
+            pointer m_data;
+            size_type m_size;
+
+            template <typename U>
+            using if_convertible = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type;
+
+        public :
+            /**
+            * @brief Cria um span vazio.
+            */
+            span( void ) noexcept
+                : m_data(nullptr)
+                , m_size(0)
+            { }
+            /**
+            * @brief Cria um span dos count elementos a partir de first.
+            * @param first     Primeiro elemento.
+            * @param count     Quantidade de elementos.
+            */
+            span( pointer first, size_type count ) noexcept
+                : m_data(first)
+                , m_size(count)
+            { }
+            /**
+            * @brief Cria um span do intervalo first-last. É um template restrito a ponteiros (como em std::span) para
+            * que span(p, 0) escolha o construtor com contagem, em vez de ser ambíguo.
+            * @param first     Primeiro elemento.
+            * @param last      Posição logo após o último elemento.
+            */
+            template <typename End, typename = typename std::enable_if<std::is_convertible<End, pointer>::value
+                                                                       and not std::is_convertible<End, size_type>::value>::type >
+            span( pointer first, End last ) noexcept
+                : m_data(first)
+                , m_size(static_cast<pointer>(last) - first)
+            { }
+            /**
+            * @brief Cria um span de um array.
+            * @param array     Array.
+            */
+            template <std::size_t N>
+            span( T (&array)[N] ) noexcept
+                : m_data(array)
+                , m_size(N)
+            { }
+            /**
+            * @brief Cria um span de todos os elementos de uma lista.
+            * @param vec     Lista.
+            */
+            template <typename U, typename Allocator, typename GrowthPolicy, typename = if_convertible<U> >
+            span( vector<U, Allocator, GrowthPolicy> &vec ) noexcept
+                : m_data(vec.data())
+                , m_size(vec.size())
+            { }
+            /**
+            * @brief Cria um span somente leitura de todos os elementos de uma lista.
+            * @param vec     Lista.
+            */
+            template <typename U, typename Allocator, typename GrowthPolicy, typename = if_convertible<const U> >
+            span( const vector<U, Allocator, GrowthPolicy> &vec ) noexcept
+                : m_data(vec.data())
+                , m_size(vec.size())
+            { }
+            /**
+            * @brief Converte um span<U> em span<T> (ex.: span<int> em span<const int>).
+            * @param other     Span convertido.
+            */
+            template <typename U, typename = if_convertible<U> >
+            span( const span<U> &other ) noexcept
+                : m_data(other.data())
+                , m_size(other.size())
+            { }
+
+            span( const span & ) noexcept = default;
+            span& operator =( const span & ) noexcept = default;
+
+            /**
+            * @brief Retorna o número de elementos.
+            */
+            size_type size( void ) const noexcept{
+                return m_size;
+            }
+            /**
+            * @brief Retorna o tamanho da visão em bytes.
+            */
+            size_type size_bytes( void ) const noexcept{
+                return m_size * sizeof(T);
+            }
+            /**
+            * @brief Retorna true se a visão não contiver nenhum elemento.
+            */
+            bool empty( void ) const noexcept{
+                return m_size == 0;
+            }
+            /**
+            * @brief Retorna um ponteiro para o primeiro elemento.
+            */
+            pointer data( void ) const noexcept{
+                return m_data;
+            }
+            /**
+            * @brief Retorna o elemento na posição pos, sem verificação de limites.
+            * @param pos     Posição do indice.
+            */
+            reference operator[]( size_type pos ) const{
+                return m_data[pos];
+            }
+            /**
+            * @brief Retorna o elemento na posição pos. Se pos não estiver dentro da visão, uma exceção do tipo std::out_of_range é lançada.
+            * @param pos     Posição do indice.
+            */
+            reference at( size_type pos ) const{
+                if(pos >= m_size)
+                    throw std::out_of_range("[at()] Cannot recover an element out of the range");
+                return m_data[pos];
+            }
+            /**
+            * @brief Retorna o primeiro elemento.
+            */
+            reference front( void ) const{
+                return m_data[0];
+            }
+            /**
+            * @brief Retorna o último elemento.
+            */
+            reference back( void ) const{
+                return m_data[m_size - 1];
+            }
+            /**
+            * @brief Retorna um iterador apontando para o primeiro elemento.
+            */
+            iterator begin( void ) const noexcept{
+                return iterator( m_data );
+            }
+            /**
+            * @brief Retorna um iterador apontando para a posição logo após o último elemento.
+            */
+            iterator end( void ) const noexcept{
+                return iterator( m_data + m_size );
+            }
+
+            /**
+            * @brief Retorna a visão dos count primeiros elementos. Se count passar do tamanho, uma exceção do tipo std::out_of_range é lançada.
+            * @param count     Quantidade de elementos.
+            */
+            span first( size_type count ) const{
+                if(count > m_size)
+                    throw std::out_of_range("[first()] Cannot take more elements than the span has");
+                return span(m_data, count);
+            }
+            /**
+            * @brief Retorna a visão dos count últimos elementos. Se count passar do tamanho, uma exceção do tipo std::out_of_range é lançada.
+            * @param count     Quantidade de elementos.
+            */
+            span last( size_type count ) const{
+                if(count > m_size)
+                    throw std::out_of_range("[last()] Cannot take more elements than the span has");
+                return span(m_data + (m_size - count), count);
+            }
+            /**
+            * @brief Retorna a visão dos count elementos a partir de offset (até o fim, se count for npos). Se o
+            * intervalo sair da visão, uma exceção do tipo std::out_of_range é lançada.
+            * @param offset     Posição do primeiro elemento.
+            * @param count      Quantidade de elementos.
+            */
+            span subspan( size_type offset, size_type count = npos ) const{
+                if(offset > m_size or (count != npos and count > m_size - offset))
+                    throw std::out_of_range("[subspan()] Cannot take a range outside the span");
+                return span(m_data + offset, count == npos ? m_size - offset : count);
+            }
+        };
+
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        span( vector<T, Allocator, GrowthPolicy> & ) -> span<T>;
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        span( const vector<T, Allocator, GrowthPolicy> & ) -> span<const T>;
+        template <typename T, std::size_t N>
+        span( T (&)[N] ) -> span<T>;
+
+        /**
+        * @brief Visão somente leitura (span<const T>).
+        */
+        template <typename T>
+        using vector_view = span<const T>;
+    }
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file stats.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Contadores de instrumentação (realocações, bytes, deslocamentos) por tipo de sc::vector
+*/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <atomic>               // std::atomic
+#include <cstdint>              // std::uint64_t
+#include <cstdlib>              // std::free
+#include <deque>                // std::deque
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex, std::lock_guard
+#include <ostream>              // std::ostream
+#include <sstream>              // std::ostringstream
+#include <string>               // std::string
+#include <type_traits>          // std::false_type, std::true_type
+#include <typeinfo>             // typeid
+
+#include <cxxabi.h>             // abi::__cxa_demangle
+
+    namespace sc{
+        /**
+        * @brief Instrumentação opcional de sc::vector. Uma lista conta suas operações quando sua GrowthPolicy é
+        * stats::counted<Policy> (ou, para todas as listas com a política padrão, quando SC_VECTOR_STATS é definida
+        * em todo o programa). Os contadores são somados por tipo de lista num registro global, que pode ser gravado
+        * em JSON com stats::registry::instance().dump_json(os). Listas sem contagem não têm custo algum: os pontos
+        * de contagem são removidos em tempo de compilação.
+        */
+        namespace stats{
+            /**
+            * @brief Contadores de um tipo de lista, somados entre todas as instâncias (e threads).
+            */
+            struct counters {
+                std::atomic<std::uint64_t> reallocations{0}; //!< Vezes que o armazenamento foi trocado por outro bloco (ao crescer, encolher ou atribuir um conteúdo maior).
+                std::atomic<std::uint64_t> bytes_allocated{0}; //!< Bytes pedidos ao alocador.
+                std::atomic<std::uint64_t> bytes_relocated{0}; //!< Bytes copiados ou movidos para um bloco novo ao crescer ou encolher (shrink_to_fit, trim, growth::trimmed).
+                std::atomic<std::uint64_t> elements_shifted{0}; //!< Elementos deslocados por insert, erase, push_front e pop_front.
+                std::atomic<std::uint64_t> peak_capacity{0}; //!< Maior capacidade (em elementos) alcançada por uma instância.
+                std::atomic<std::uint64_t> wasted_bytes{0}; //!< Capacidade não usada, em bytes, somada no fim da vida de cada instância.
+
+                /**
+                * @brief Atualiza peak_capacity com capacity, se for maior.
+                * @param capacity     Capacidade alcançada.
+                */
+                void observe_capacity( std::uint64_t capacity ){
+                    std::uint64_t peak = peak_capacity.load(std::memory_order_relaxed);
+                    while(capacity > peak and not peak_capacity.compare_exchange_weak(peak, capacity, std::memory_order_relaxed))
+                        ;
+                }
+                /**
+                * @brief Zera os contadores.
+                */
+                void reset( void ){
+                    for(auto *c : { &reallocations, &bytes_allocated, &bytes_relocated, &elements_shifted, &peak_capacity, &wasted_bytes })
+                        c->store(0, std::memory_order_relaxed);
+                }
+            };
+
+            /**
+            * @brief Registro global dos contadores, um conjunto por tipo de lista.
+            */
+            class registry {
+                struct entry {
+                    std::string name;
+                    counters values;
+                };
+
+                mutable std::mutex m_mutex;
+                std::deque<entry> m_entries; //!< deque: as referências entregues por add() nunca mudam de lugar.
+
+                registry( void ) = default;
+
+            public :
+                registry( const registry & ) = delete;
+                registry& operator =( const registry & ) = delete;
+
+                /**
+                * @brief Retorna o registro do programa.
+                */
+                static registry & instance( void ){
+                    static registry r;
+                    return r;
+                }
+                /**
+                * @brief Cria os contadores do tipo name e os retorna. Chamada uma vez por tipo (ver counters_for).
+                * @param name     Nome do tipo.
+                */
+                counters & add( std::string name ){
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_entries.emplace_back();
+                    m_entries.back().name = std::move(name);
+                    return m_entries.back().values;
+                }
+                /**
+                * @brief Zera todos os contadores.
+                */
+                void reset( void ){
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for(auto &e : m_entries)
+                        e.values.reset();
+                }
+                /**
+                * @brief Grava os contadores de todos os tipos como um objeto JSON, indexado pelo nome do tipo.
+                * @param os     Stream de saída.
+                */
+                void dump_json( std::ostream &os ) const{
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    os << "{";
+                    const char *separator = "\n";
+                    for(const auto &e : m_entries){
+                        const counters &c = e.values;
+                        os << separator << "  \"";
+                        for(char ch : e.name){
+                            if(ch == '"' or ch == '\\')
+                                os << '\\';
+                            os << ch;
+                        }
+                        os << "\": {"
+                           << "\"reallocations\": " << c.reallocations.load()
+                           << ", \"bytes_allocated\": " << c.bytes_allocated.load()
+                           << ", \"bytes_relocated\": " << c.bytes_relocated.load()
+                           << ", \"elements_shifted\": " << c.elements_shifted.load()
+                           << ", \"peak_capacity\": " << c.peak_capacity.load()
+                           << ", \"wasted_bytes\": " << c.wasted_bytes.load() << "}";
+                        separator = ",\n";
+                    }
+                    os << (m_entries.empty() ? "}" : "\n}") << "\n";
+                }
+                /**
+                * @brief Retorna dump_json() como string.
+                */
+                std::string to_json( void ) const{
+                    std::ostringstream os;
+                    dump_json(os);
+                    return os.str();
+                }
+            };
+
+            /**
+            * @brief Nome legível do tipo T (demangled).
+            */
+            template <typename T>
+            std::string type_name( void ){
+                int status = 0;
+                std::unique_ptr<char, void (*)(void *)> name(abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status), std::free);
+                return status == 0 ? std::string(name.get()) : std::string(typeid(T).name());
+            }
+            /**
+            * @brief Retorna os contadores do tipo de lista Container, registrando-os no primeiro uso.
+            */
+            template <typename Container>
+            counters & counters_for( void ){
+                static counters &c = registry::instance().add(type_name<Container>());
+                return c;
+            }
+
+            /**
+            * @brief GrowthPolicy que cresce como Policy e liga a contagem nas listas que a usam.
+            * @tparam Policy     Política de crescimento real (ver growth.h).
+            */
+            template <typename Policy>
+            struct counted : Policy { };
+
+            template <typename Policy>
+            struct is_counted : std::false_type { };
+            template <typename Policy>
+            struct is_counted< counted<Policy> > : std::true_type { };
+        }
+    }
+
+#endif
@@ -0,0 +1,342 @@
+/**
+ * @file thread_pool.h
+ * @author Janeto Erick
+ * @author Julio Cesar
+ * @brief Pool de threads com roubo de tarefas e particionamento de blocos contíguos, usados pelos algoritmos paralelos
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>            // std::min, std::max
+#include <atomic>               // std::atomic
+#include <chrono>               // std::chrono::milliseconds
+#include <condition_variable>   // std::condition_variable
+#include <cstddef>              // std::size_t
+#include <cstdint>              // std::uintptr_t
+#include <deque>                // std::deque
+#include <exception>            // std::exception_ptr
+#include <functional>           // std::function
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex, std::lock_guard
+#include <thread>               // std::thread
+#include <vector>               // std::vector
+
+    namespace sc{
+        /**
+        * @brief Pool de threads com roubo de tarefas (work stealing). Cada thread tem sua fila: consome as próprias
+        * tarefas pelo fim e, quando ela se esvazia, rouba do início das filas das outras. Quem chama run() também
+        * executa tarefas enquanto espera, de modo que chamadas aninhadas não travam o pool.
+        */
+        class thread_pool {
+
+        private :
+            using task = std::function<void( void )>;
+
+            /// Fila de uma thread.
+            struct queue {
+                std::mutex mutex;
+                std::deque<task> tasks;
+            };
+
+            std::vector<std::thread> m_threads;
+            std::vector<std::unique_ptr<queue>> m_queues; //!< Uma fila por thread.
+            std::atomic<std::size_t> m_pending; //!< Tarefas enfileiradas e ainda não retiradas.
+            std::atomic<std::size_t> m_next; //!< Fila que recebe a próxima tarefa (round robin).
+            bool m_stop;
+            std::mutex m_sleep_mutex;
+            std::condition_variable m_wakeup;
+
+            /**
+            * @brief Retira a tarefa mais recente da fila de self.
+            * @param self     Índice da fila.
+            * @param out      Tarefa retirada.
+            */
+            bool pop( std::size_t self, task &out ){
+                queue &q = *m_queues[self];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if(q.tasks.empty())
+                    return false;
+                out = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                m_pending--;
+                return true;
+            }
+            /**
+            * @brief Rouba a tarefa mais antiga de alguma fila diferente de self.
+            * @param self     Índice da fila de quem rouba (m_queues.size() para quem não tem fila).
+            * @param out      Tarefa roubada.
+            */
+            bool steal( std::size_t self, task &out ){
+                for(std::size_t i = 1; i <= m_queues.size(); ++i){
+                    std::size_t victim = (self + i) % m_queues.size();
+                    if(victim == self)
+                        continue;
+                    queue &q = *m_queues[victim];
+                    std::lock_guard<std::mutex> lock(q.mutex);
+                    if(q.tasks.empty())
+                        continue;
+                    out = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                    m_pending--;
+                    return true;
+                }
+                return false;
+            }
+            /**
+            * @brief Laço de uma thread do pool: executa as próprias tarefas, rouba das outras ou dorme.
+            * @param self     Índice da thread.
+            */
+            void work( std::size_t self ){
+                while(true){
+                    task t;
+                    if(pop(self, t) or steal(self, t)){
+                        t();
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+                    m_wakeup.wait_for(lock, std::chrono::milliseconds(100), [this]{ return m_stop or m_pending != 0; });
+                    if(m_stop and m_pending == 0)
+                        return;
+                }
+            }
+            /**
+            * @brief Enfileira uma tarefa e acorda uma thread.
+            * @param t     Tarefa.
+            */
+            void submit( task t ){
+                queue &q = *m_queues[m_next++ % m_queues.size()];
+                {
+                    std::lock_guard<std::mutex> lock(q.mutex);
+                    q.tasks.push_back(std::move(t));
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                    m_pending++;
+                }
+                m_wakeup.notify_one();
+            }
+
+        public :
+            /**
+            * @brief Cria um pool com workers threads (0 cria um pool que executa tudo na thread que chama run()).
+            * @param workers     Quantidade de threads.
+            */
+            explicit thread_pool( std::size_t workers )
+                : m_pending(0)
+                , m_next(0)
+                , m_stop(false)
+            {
+                for(std::size_t i = 0; i < workers; ++i)
+                    m_queues.push_back(std::make_unique<queue>());
+                for(std::size_t i = 0; i < workers; ++i)
+                    m_threads.emplace_back([this, i]{ work(i); });
+            }
+
+            thread_pool( const thread_pool & ) = delete;
+            thread_pool& operator =( const thread_pool & ) = delete;
+
+            /**
+            * @brief Termina as tarefas pendentes e encerra as threads.
+            */
+            ~thread_pool( void ){
+                {
+                    std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                    m_stop = true;
+                }
+                m_wakeup.notify_all();
+                for(auto &t : m_threads)
+                    t.join();
+            }
+            /**
+            * @brief Retorna a quantidade de threads do pool (sem contar quem chama run()).
+            */
+            std::size_t size( void ) const{
+                return m_threads.size();
+            }
+            /**
+            * @brief Executa uma tarefa pendente qualquer, se houver. Retorna false se não havia nenhuma.
+            */
+            bool run_one( void ){
+                task t;
+                if(m_queues.empty() or not steal(m_queues.size(), t))
+                    return false;
+                t();
+                return true;
+            }
+            /**
+            * @brief Executa f(0), f(1), ..., f(tasks - 1) no pool e espera todas terminarem. A thread que chama
+            * executa f(0) e ajuda com as demais. Se alguma chamada lançar exceção, a primeira é relançada aqui.
+            * @param tasks     Quantidade de tarefas.
+            * @param f         Função chamada com o índice de cada tarefa.
+            */
+            template <typename F>
+            void run( std::size_t tasks, F f ){
+                if(m_threads.empty() or tasks < 2){
+                    for(std::size_t k = 0; k < tasks; ++k)
+                        f(k);
+                    return;
+                }
+                std::atomic<std::size_t> remaining(tasks);
+                std::exception_ptr error;
+                std::mutex error_mutex;
+                auto body = [&]( std::size_t k ){
+                    try {
+                        f(k);
+                    } catch(...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if(not error)
+                            error = std::current_exception();
+                    }
+                    remaining.fetch_sub(1, std::memory_order_release);
+                };
+                for(std::size_t k = 1; k < tasks; ++k)
+                    submit([&body, k]{ body(k); });
+                body(0);
+                while(remaining.load(std::memory_order_acquire) != 0){
+                    if(not run_one())
+                        std::this_thread::yield();
+                }
+                if(error)
+                    std::rethrow_exception(error);
+            }
+        };
+
+        /**
+        * @brief Configuração e particionamento dos algoritmos paralelos (ver parallel.h).
+        */
+        namespace parallel{
+            namespace detail{
+                /// Configuração global e o pool compartilhado, criado na primeira vez que é usado.
+                struct settings {
+                    std::atomic<std::size_t> threads{std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+                    std::atomic<std::size_t> cutoff{1 << 20};
+                    std::mutex mutex;
+                    std::unique_ptr<thread_pool> pool;
+                };
+                inline settings & config( void ){
+                    static settings s;
+                    return s;
+                }
+            }
+
+            inline constexpr std::size_t cache_line = 64; //!< Os blocos de cada tarefa começam numa linha de cache própria.
+
+            /**
+            * @brief Retorna quantas threads os algoritmos paralelos usam (incluindo quem os chama).
+            */
+            inline std::size_t thread_count( void ){
+                return detail::config().threads;
+            }
+            /**
+            * @brief Define quantas threads os algoritmos paralelos usam (1 desliga o paralelismo). Não deve ser chamada
+            * enquanto algum algoritmo paralelo estiver executando.
+            * @param threads     Quantidade de threads, incluindo quem chama os algoritmos.
+            */
+            inline void set_thread_count( std::size_t threads ){
+                auto &s = detail::config();
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.threads = std::max<std::size_t>(1, threads);
+                s.pool.reset();
+            }
+            /**
+            * @brief Retorna o tamanho abaixo do qual os algoritmos paralelos executam em série.
+            */
+            inline std::size_t serial_cutoff( void ){
+                return detail::config().cutoff;
+            }
+            /**
+            * @brief Define o tamanho (em elementos) abaixo do qual os algoritmos paralelos executam em série.
+            * @param elements     Novo limite.
+            */
+            inline void set_serial_cutoff( std::size_t elements ){
+                detail::config().cutoff = elements;
+            }
+            /**
+            * @brief Retorna o pool compartilhado, com thread_count() - 1 threads.
+            */
+            inline thread_pool & default_pool( void ){
+                auto &s = detail::config();
+                std::lock_guard<std::mutex> lock(s.mutex);
+                if(not s.pool)
+                    s.pool = std::make_unique<thread_pool>(s.threads - 1);
+                return *s.pool;
+            }
+
+            /**
+            * @brief Divisão de [0, n) em blocos, um por tarefa. Cada limite interno é arredondado para cima até um
+            * elemento que comece numa linha de cache, para que duas tarefas não escrevam na mesma linha. Quando o
+            * tamanho do elemento não divide 64, esse elemento pode não existir (ver boundary) e o alinhamento é só uma
+            * tentativa.
+            */
+            struct partition {
+                std::uintptr_t base; //!< Endereço do elemento 0.
+                std::size_t element_size;
+                std::size_t size; //!< Quantidade de elementos.
+                std::size_t chunks; //!< Quantidade de blocos (1 = execução em série).
+
+                /**
+                * @brief Retorna o início do bloco k (boundary(chunks) == size).
+                * @param k     Índice do bloco.
+                */
+                std::size_t boundary( std::size_t k ) const{
+                    if(k == 0)
+                        return 0;
+                    if(k >= chunks)
+                        return size;
+                    std::size_t ideal = size / chunks * k + size % chunks * k / chunks;
+                    // Os endereços dos elementos voltam ao mesmo resto módulo cache_line a cada cache_line elementos no
+                    // máximo: se algum deles começa numa linha, é encontrado aqui. Se nenhum começa (elementos com
+                    // tamanho não divisor de 64 e base desalinhada), o limite fica em ideal e a linha dele é dividida.
+                    for(std::size_t j = ideal; j < ideal + cache_line and j < size; ++j)
+                        if((base + j * element_size) % cache_line == 0)
+                            return j;
+                    return ideal;
+                }
+            };
+            /**
+            * @brief Divide os n elementos a partir de base em blocos. Abaixo de serial_cutoff(), ou com uma única
+            * thread, retorna um único bloco. Cada thread recebe em média quatro blocos, para que as mais rápidas
+            * roubem trabalho das mais lentas.
+            * @param base     Primeiro elemento.
+            * @param n        Quantidade de elementos.
+            */
+            template <typename T>
+            partition split( const T *base, std::size_t n ){
+                std::size_t threads = thread_count();
+                std::size_t chunks = 1;
+                if(n != 0 and n >= serial_cutoff() and threads > 1){
+                    std::size_t per_line = std::max<std::size_t>(1, cache_line / sizeof(T));
+                    chunks = std::max<std::size_t>(1, std::min(threads * 4, n / per_line));
+                }
+                return partition{ reinterpret_cast<std::uintptr_t>(base), sizeof(T), n, chunks };
+            }
+            /**
+            * @brief Chama f(k, begin, end) para cada bloco k = [begin, end) da partição, em paralelo no pool compartilhado.
+            * @param p     Partição (ver split).
+            * @param f     Função chamada para cada bloco.
+            */
+            template <typename F>
+            void for_chunks( const partition &p, F f ){
+                if(p.chunks == 1){
+                    f(std::size_t(0), std::size_t(0), p.size);
+                    return;
+                }
+                default_pool().run(p.chunks, [&]( std::size_t k ){
+                    f(k, p.boundary(k), p.boundary(k + 1));
+                });
+            }
+            /**
+            * @brief Chama f(k, begin, end) para cada bloco [begin, end) de split(base, n), em paralelo no pool compartilhado.
+            * @param base     Primeiro elemento.
+            * @param n        Quantidade de elementos.
+            * @param f        Função chamada para cada bloco.
+            */
+            template <typename T, typename F>
+            void for_chunks( const T *base, std::size_t n, F f ){
+                for_chunks(split(base, n), f);
+            }
+        }
+    }
+
+#endif
@@ -5,15 +5,184 @@
  * @brief Implementação da classe Vector em C++
 */
 
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include <algorithm>            // std::max, std::move_backward, std::fill_n, std::rotate
+#include <atomic>               // std::atomic
+#include <cstddef>              // std::size_t
+#include <cstdint>              // std::uint64_t, std::uintptr_t
+#include <cstring>              // std::memcpy, std::memset
+#include <initializer_list>     // std::initializer_list
+#include <iostream>             // std::cout
+#include <iterator>             // std::iterator_traits, std::distance
+#include <memory>               // std::allocator, std::allocator_traits
+#include <memory_resource>      // std::pmr::polymorphic_allocator
+#include <stdexcept>            // std::out_of_range
+#include <type_traits>          // std::is_trivially_copyable
+#include <utility>              // std::move
+
+#include <sys/mman.h>           // madvise
+#include <unistd.h>             // sysconf
+
+#include "debug.h"
+#include "growth.h"
 #include "iterator.h"
+#include "simd.h"
+#include "stats.h"
+#include "thread_pool.h"
 
     namespace sc{
-        template <typename T>
+        namespace detail{
+            /**
+            * @brief Destrói os objetos no intervalo first-last através do alocador, sem liberar a memória.
+            * @param alloc     Alocador dono da memória.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            template <typename Allocator, typename T>
+            void destroy( Allocator &alloc, T *first, T *last ){
+                for(; first != last; ++first)
+                    std::allocator_traits<Allocator>::destroy(alloc, first);
+            }
+            /**
+            * @brief Constrói cópias do intervalo first-last a partir de dest. Se uma cópia lançar exceção, as anteriores são destruídas.
+            * @param alloc     Alocador dono da memória.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            * @param dest      Início da memória não inicializada.
+            */
+            template <typename Allocator, typename InputIt, typename T>
+            T * construct_range( Allocator &alloc, InputIt first, InputIt last, T *dest ){
+                T * current = dest;
+                try {
+                    for(; first != last; ++first, ++current)
+                        std::allocator_traits<Allocator>::construct(alloc, current, *first);
+                } catch(...) {
+                    destroy(alloc, dest, current);
+                    throw;
+                }
+                return current;
+            }
+            /**
+            * @brief Indica se It percorre memória contígua (ponteiros e MyIterator), permitindo cópias em bloco.
+            */
+            template <typename It>
+            struct is_contiguous_iterator : std::is_pointer<It> { };
+            template <typename U>
+            struct is_contiguous_iterator< MyIterator<U> > : std::true_type { };
+            /**
+            * @brief Indica se It pode ser percorrido mais de uma vez (iteradores de avanço ou melhores), permitindo medir o intervalo antes de copiá-lo. Iteradores de entrada, como std::istream_iterator, só podem ser lidos uma vez.
+            */
+            template <typename It>
+            struct is_forward_iterator : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category> { };
+            /**
+            * @brief Copia n elementos a partir de first para dest (posições já vivas ou, para T trivialmente copiável, memória bruta). Quando T é trivialmente copiável e a origem é contígua, faz um único memcpy.
+            * @tparam Parallel  Se true, blocos enormes são copiados em paralelo (ver parallel_first_touch); por padrão, a cópia fica na thread que chama.
+            * @param first     Inicio do intervalo copiado.
+            * @param n         Quantidade de elementos.
+            * @param dest      Destino.
+            */
+            template <bool Parallel = false, typename It, typename T>
+            void copy_n( It first, std::size_t n, T *dest ){
+                using source_type = typename std::remove_cv<typename std::iterator_traits<It>::value_type>::type;
+                if constexpr (std::is_trivially_copyable<T>::value and std::is_same<source_type, T>::value
+                              and is_contiguous_iterator<It>::value){
+                    if(n == 0)
+                        return;
+                    const T *source = &*first;
+                    if(not Parallel or n < parallel::serial_cutoff()){
+                        std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), n * sizeof(T));
+                        return;
+                    }
+                    // Blocos enormes são copiados em paralelo.
+                    parallel::for_chunks(dest, n, [&]( std::size_t, std::size_t begin, std::size_t end ){
+                        std::memcpy(static_cast<void*>(dest + begin), static_cast<const void*>(source + begin), (end - begin) * sizeof(T));
+                    });
+                } else
+                    std::copy_n(first, n, dest);
+            }
+            /**
+            * @brief Indica se o alocador pede que as escritas em bloco de T trivialmente copiável acima de parallel::serial_cutoff() (zerar em resize, copiar, preencher, transferir ao crescer) sejam divididas entre as threads do pool, o que o alocador declara com o membro parallel_first_touch (ver aligned_allocator.h). Sem ele, nenhuma operação da lista usa o pool.
+            */
+            template <typename Allocator, typename = void>
+            struct parallel_first_touch : std::false_type { };
+            template <typename Allocator>
+            struct parallel_first_touch< Allocator, std::void_t<typename Allocator::parallel_first_touch> > : Allocator::parallel_first_touch { };
+            /**
+            * @brief Transfere os n primeiros elementos de origem para a memória não inicializada de destino, escolhendo a forma mais barata que T permite. Ao final, a origem não contém mais objetos vivos.
+            * @param alloc      Alocador dono da memória.
+            * @param source     Armazenamento antigo.
+            * @param n          Quantidade de elementos a transferir.
+            * @param dest       Armazenamento novo.
+            */
+            template <typename Allocator, typename T>
+            void relocate( Allocator &alloc, T *source, std::size_t n, T *dest ){
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    copy_n<parallel_first_touch<Allocator>::value>(source, n, dest);
+                } else if constexpr (std::is_nothrow_move_constructible<T>::value
+                                   or not std::is_copy_constructible<T>::value){
+                    for(std::size_t i(0); i < n; ++i)
+                        std::allocator_traits<Allocator>::construct(alloc, dest + i, std::move(source[i]));
+                    destroy(alloc, source, source + n);
+                } else {
+                    construct_range(alloc, source, source + n, dest);
+                    destroy(alloc, source, source + n);
+                }
+            }
+            /**
+            * @brief Devolve ao sistema as páginas inteiras contidas em [first, last), sem liberar o endereço: o conteúdo
+            * é descartado e a página volta zerada se for tocada de novo. É só um aviso ao kernel; falhas são ignoradas.
+            * @param first     Início da região.
+            * @param last      Fim da região.
+            */
+            inline void release_pages( void *first, void *last ){
+                static const std::uintptr_t page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+                std::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(first) + page - 1) & ~(page - 1);
+                std::uintptr_t end = reinterpret_cast<std::uintptr_t>(last) & ~(page - 1);
+                if(begin < end)
+                    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+            }
+            /**
+            * @brief Grava n cópias de value a partir de dest (posições já vivas ou, para T trivialmente copiável, memória bruta).
+            * @tparam Parallel  Se true e T for trivialmente copiável, blocos enormes são preenchidos em paralelo (ver parallel_first_touch); por padrão, o preenchimento fica na thread que chama.
+            * @param dest      Destino.
+            * @param n         Quantidade de cópias.
+            * @param value     Valor copiado.
+            */
+            template <bool Parallel = false, typename T>
+            void fill_n( T *dest, std::size_t n, const T &value ){
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    const T copy = value; // value pode estar dentro de [dest, dest + n)
+                    if(not Parallel or n < parallel::serial_cutoff()){
+                        std::fill(dest, dest + n, copy);
+                        return;
+                    }
+                    parallel::for_chunks(dest, n, [&]( std::size_t, std::size_t begin, std::size_t end ){
+                        std::fill(dest + begin, dest + end, copy);
+                    });
+                } else
+                    std::fill_n(dest, n, value);
+            }
+        }
+
+        template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+        class small_vector;
+
+        /**
+        * @brief Lista dinâmica contígua.
+        * @tparam T               Tipo dos elementos.
+        * @tparam Allocator       Alocador usado para obter a memória bruta e construir os elementos.
+        * @tparam GrowthPolicy    Regra de crescimento da capacidade (ver growth.h).
+        */
+        template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = growth::default_policy >
         class vector {
 
         public :
             using size_type = unsigned long; //!< The size type.
             using value_type = T; //!< The value type.
+            using allocator_type = Allocator; //!< The allocator type.
+            using growth_policy = GrowthPolicy; //!< The capacity growth policy.
             using pointer = value_type*; //!< Pointer to a value stored in the container.
             using reference = value_type&; //!< Reference to a value stored in the container.
             using const_reference = const value_type&; //!< Const reference to a value stored in the co
@@ -21,51 +190,554 @@
             using const_iterator = MyIterator< const T >; // See Code 3
 
         private :
+            using alloc_traits = std::allocator_traits<Allocator>;
+
             size_type m_end;
             size_type m_capacity;
-            T *m_storage;
-            //std::unique_ptr<T[]> m_storage; //!< Data storage area for the dynamic array.
+            pointer m_storage; //!< Memória bruta: apenas [0, m_end) contém objetos construídos.
+            Allocator m_alloc;
+
+            static constexpr bool parallel_writes = detail::parallel_first_touch<Allocator>::value; //!< Se cópias e preenchimentos enormes usam o pool (ver detail::parallel_first_touch).
+            static constexpr bool counted = stats::is_counted<GrowthPolicy>::value; //!< Se a lista conta suas operações (ver stats.h).
+#ifdef SC_VECTOR_DEBUG
+            mutable std::shared_ptr<debug::state> m_debug; //!< Estado compartilhado com os iteradores (ver debug.h).
+#endif
+
+            /**
+            * @brief Soma n ao contador field deste tipo de lista. Sem contagem (ver stats.h), não gera código.
+            * @param field     Contador.
+            * @param n         Valor somado.
+            */
+            static void count( std::atomic<std::uint64_t> stats::counters::*field, std::uint64_t n ){
+                if constexpr (counted)
+                    (stats::counters_for<vector>().*field).fetch_add(n, std::memory_order_relaxed);
+            }
+
+            /**
+            * @brief Obtém memória bruta (sem construir objetos) para n elementos.
+            * @param n     Quantidade de posições.
+            */
+            pointer allocate( size_type n ){
+                if constexpr (counted){
+                    count(&stats::counters::bytes_allocated, n * sizeof(T));
+                    stats::counters_for<vector>().observe_capacity(n);
+                }
+                return n == 0 ? nullptr : alloc_traits::allocate(m_alloc, n);
+            }
+            /**
+            * @brief Devolve ao alocador um bloco obtido com allocate(). Se for o bloco atual, os iteradores são invalidados; um bloco novo descartado porque a cópia falhou não os afeta.
+            * @param p     Bloco a ser liberado.
+            * @param n     Quantidade de posições do bloco.
+            */
+            void deallocate( pointer p, size_type n ){
+                if(p == m_storage)
+                    invalidate_iterators();
+                if(p != nullptr and not is_external(p))
+                    alloc_traits::deallocate(m_alloc, p, n);
+            }
+            /**
+            * @brief Invalida os iteradores existentes (só no modo de depuração, ver debug.h): chamada sempre que o bloco atual é liberado e em clear().
+            */
+            void invalidate_iterators( void ){
+#ifdef SC_VECTOR_DEBUG
+                if(m_debug != nullptr)
+                    ++m_debug->generation;
+#endif
+            }
+            /**
+            * @brief Cria um iterador para p; no modo de depuração, ligado ao estado da lista.
+            * @param p     Posição.
+            */
+            template <typename U>
+            MyIterator<U> make_iterator( U *p ) const{
+#ifdef SC_VECTOR_DEBUG
+                if(m_debug == nullptr)
+                    m_debug = std::make_shared<debug::state>();
+                return MyIterator<U>(p, m_debug);
+#else
+                return MyIterator<U>(p);
+#endif
+            }
+            /**
+            * @brief No modo de depuração, passa a usar o estado de other, cujo bloco esta lista acabou de tomar: os iteradores
+            * de other continuam válidos e pertencem a esta lista. other recebe um estado novo quando criar outro iterador.
+            * @param other     Lista cujo bloco foi tomado.
+            */
+            void take_debug_state( vector &other ){
+#ifdef SC_VECTOR_DEBUG
+                m_debug = std::move(other.m_debug);
+                other.m_debug = nullptr;
+#else
+                (void) other;
+#endif
+            }
+            /**
+            * @brief No modo de depuração, encerra o programa se it não for um iterador válido desta lista.
+            * @param it     Iterador recebido.
+            */
+            void check_iterator( const_iterator it ) const{
+#ifdef SC_VECTOR_DEBUG
+                it.check_owner(m_debug.get());
+#else
+                (void) it;
+#endif
+            }
+            /**
+            * @brief Constrói um objeto na posição p com os argumentos dados.
+            * @param p       Posição não inicializada.
+            * @param args    Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            void construct( pointer p, Args&&... args ){
+                alloc_traits::construct(m_alloc, p, std::forward<Args>(args)...);
+            }
+            /**
+            * @brief Destrói os objetos no intervalo first-last, sem liberar a memória.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            void destroy( pointer first, pointer last ){
+                detail::destroy(m_alloc, first, last);
+            }
+            /**
+            * @brief Constrói cópias do intervalo first-last a partir de dest. Se uma cópia lançar exceção, as anteriores são destruídas.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            * @param dest      Início da memória não inicializada.
+            */
+            template <typename InputIt>
+            pointer construct_range( InputIt first, InputIt last, pointer dest ){
+                using source_type = typename std::remove_cv<typename std::iterator_traits<InputIt>::value_type>::type;
+                if constexpr (std::is_trivially_copyable<T>::value and std::is_same<source_type, T>::value
+                              and detail::is_contiguous_iterator<InputIt>::value){
+                    // Cópia em bloco (em paralelo para blocos enormes, se o alocador pedir).
+                    size_type n = last - first;
+                    detail::copy_n<parallel_writes>(first, n, dest);
+                    return dest + n;
+                } else
+                    return detail::construct_range(m_alloc, first, last, dest);
+            }
+            /**
+            * @brief Constrói n cópias de value a partir de dest. Se uma cópia lançar exceção, as anteriores são destruídas.
+            * @param dest      Início da memória não inicializada.
+            * @param n         Quantidade de cópias.
+            * @param value     Valor copiado.
+            */
+            void construct_fill( pointer dest, size_type n, const_reference value ){
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    detail::fill_n<parallel_writes>(dest, n, value);
+                    return;
+                }
+                size_type i(0);
+                try {
+                    for(; i < n; ++i)
+                        construct(dest + i, value);
+                } catch(...) {
+                    destroy(dest, dest + i);
+                    throw;
+                }
+            }
+            /**
+            * @brief Transfere os n primeiros elementos de origem para a memória não inicializada de destino, escolhendo a forma mais barata que T permite. Ao final, a origem não contém mais objetos vivos.
+            * @param source     Armazenamento antigo.
+            * @param n          Quantidade de elementos a transferir.
+            * @param dest       Armazenamento novo.
+            */
+            void relocate( pointer source, size_type n, pointer dest ){
+                detail::relocate(m_alloc, source, n, dest);
+            }
+            /**
+            * @brief Único ponto de realocação da lista: aloca new_cap posições, transfere os elementos e libera o bloco antigo.
+            * @param new_cap     Nova capacidade do armazenamento.
+            */
+            void reallocate( size_type new_cap ){
+                pointer new_storage = allocate(new_cap);
+                try {
+                    relocate(m_storage, m_end, new_storage);
+                } catch(...) {
+                    deallocate(new_storage, new_cap);
+                    throw;
+                }
+                deallocate(m_storage, m_capacity);
+                m_storage = new_storage;
+                m_capacity = new_cap;
+                count(&stats::counters::reallocations, 1);
+                count(&stats::counters::bytes_relocated, m_end * sizeof(T));
+            }
+            /**
+            * @brief Variante do motor de realocação que constrói n elementos novos no fim do bloco novo, com build(destino), antes de transferir os antigos, pois a origem dos novos pode ser o bloco antigo. build deve destruir o que construiu se lançar exceção.
+            * @param new_cap     Nova capacidade do armazenamento.
+            * @param n           Quantidade de elementos novos.
+            * @param build       Constrói os n elementos a partir do ponteiro recebido.
+            */
+            template <typename Build>
+            void reallocate_with( size_type new_cap, size_type n, Build &&build ){
+                pointer new_storage = allocate(new_cap);
+                try {
+                    build(new_storage + m_end);
+                } catch(...) {
+                    deallocate(new_storage, new_cap);
+                    throw;
+                }
+                try {
+                    relocate(m_storage, m_end, new_storage);
+                } catch(...) {
+                    destroy(new_storage + m_end, new_storage + m_end + n);
+                    deallocate(new_storage, new_cap);
+                    throw;
+                }
+                deallocate(m_storage, m_capacity);
+                m_storage = new_storage;
+                m_capacity = new_cap;
+                count(&stats::counters::reallocations, 1);
+                count(&stats::counters::bytes_relocated, m_end * sizeof(T));
+            }
+            /**
+            * @brief Realoca para new_cap construindo um novo elemento no fim a partir de args (ver reallocate_with).
+            * @param new_cap     Nova capacidade do armazenamento.
+            * @param args        Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            void reallocate_append( size_type new_cap, Args&&... args ){
+                reallocate_with(new_cap, 1, [&]( pointer dest ){
+                    construct(dest, std::forward<Args>(args)...);
+                });
+            }
+            /**
+            * @brief Acrescenta n elementos ao final, construídos por build(destino), com no máximo uma decisão de crescimento.
+            * @param n         Quantidade de elementos novos.
+            * @param build     Constrói os n elementos a partir do ponteiro recebido.
+            */
+            template <typename Build>
+            void append_with( size_type n, Build &&build ){
+                if(n == 0)
+                    return;
+                if(m_end + n > m_capacity)
+                    reallocate_with(next_capacity(m_end + n), n, build);
+                else
+                    build(m_storage + m_end);
+                m_end += n;
+            }
+            /**
+            * @brief Constrói n elementos inicializados por valor a partir de dest. Se uma construção lançar exceção, as anteriores são destruídas.
+            * @param dest     Início da memória não inicializada.
+            * @param n        Quantidade de elementos.
+            */
+            void construct_default( pointer dest, size_type n ){
+                if constexpr (std::is_trivially_default_constructible<T>::value and std::is_trivially_copyable<T>::value){
+                    // Inicializar por valor um tipo trivial é zerá-lo. Se o alocador pedir (ver detail::parallel_first_touch),
+                    // blocos enormes são zerados em paralelo, nos blocos de parallel::split.
+                    if(not parallel_writes or n < parallel::serial_cutoff()){
+                        if(n != 0)
+                            std::memset(static_cast<void*>(dest), 0, n * sizeof(T));
+                        return;
+                    }
+                    parallel::for_chunks(dest, n, [&]( std::size_t, std::size_t begin, std::size_t end ){
+                        std::memset(static_cast<void*>(dest + begin), 0, (end - begin) * sizeof(T));
+                    });
+                    return;
+                }
+                size_type i(0);
+                try {
+                    for(; i < n; ++i)
+                        construct(dest + i);
+                } catch(...) {
+                    destroy(dest, dest + i);
+                    throw;
+                }
+            }
+            /**
+            * @brief Retorna a capacidade usada no próximo crescimento, segundo a GrowthPolicy.
+            * @param required     Quantidade mínima de posições necessária.
+            */
+            size_type next_capacity( size_type required ) const{
+                return GrowthPolicy::next_capacity(m_capacity, required, sizeof(T));
+            }
+            /**
+            * @brief Com a política growth::trimmed, encolhe o bloco para max(2 * size(), trim_min_capacity) se a ocupação caiu abaixo do limite da política. Chamada depois de cada remoção; sem a política, não gera código.
+            */
+            void auto_trim( void ){
+                if constexpr (growth::is_trimmed<GrowthPolicy>::value){
+                    size_type target = std::max<size_type>(2 * m_end, GrowthPolicy::trim_min_capacity);
+                    if(m_end * 100 < m_capacity * GrowthPolicy::trim_percent and target < m_capacity and not is_external(m_storage))
+                        reallocate(target);
+                }
+            }
+            /**
+            * @brief Substitui o conteúdo pelos n elementos a partir de first, reaproveitando os objetos já construídos.
+            * @param first     Inicio do intervalo.
+            * @param n         Tamanho do intervalo.
+            */
+            template <typename ForwardIt>
+            void assign_range( ForwardIt first, size_type n ){
+                if(n > m_capacity){
+                    pointer new_storage = allocate(n);
+                    try {
+                        construct_range(first, std::next(first, n), new_storage);
+                    } catch(...) {
+                        deallocate(new_storage, n);
+                        throw;
+                    }
+                    destroy(m_storage, m_storage + m_end);
+                    deallocate(m_storage, m_capacity);
+                    m_storage = new_storage;
+                    m_capacity = n;
+                    count(&stats::counters::reallocations, 1);
+                } else if(n > m_end){
+                    ForwardIt mid = std::next(first, m_end);
+                    std::copy(first, mid, m_storage);
+                    construct_range(mid, std::next(mid, n - m_end), m_storage + m_end);
+                } else {
+                    std::copy(first, std::next(first, n), m_storage);
+                    destroy(m_storage + n, m_storage + m_end);
+                }
+                m_end = n;
+            }
+            /**
+            * @brief Abre n posições a partir de pos e copia para elas os elementos a partir de first.
+            * @param pos       Índice da inserção.
+            * @param first     Inicio do intervalo inserido.
+            * @param n         Tamanho do intervalo inserido.
+            */
+            template <typename ForwardIt>
+            void insert_range( size_type pos, ForwardIt first, size_type n ){
+                if(n == 0)
+                    return;
+                if(m_end + n > m_capacity)
+                    reallocate(next_capacity(m_end + n));
+
+                pointer p = m_storage + pos;
+                pointer old_end = m_storage + m_end;
+                size_type tail = m_end - pos;
+                count(&stats::counters::elements_shifted, tail);
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    // Um memmove abre o espaço e um memcpy (quando a origem é contígua) o preenche.
+                    if(tail != 0)
+                        std::memmove(static_cast<void*>(p + n), static_cast<const void*>(p), tail * sizeof(T));
+                    detail::copy_n<parallel_writes>(first, n, p);
+                } else if(tail > n){
+                    for(size_type i(0); i < n; ++i)
+                        construct(old_end + i, std::move(*(old_end - n + i)));
+                    std::move_backward(p, old_end - n, old_end);
+                    std::copy(first, std::next(first, n), p);
+                } else {
+                    ForwardIt mid = std::next(first, tail);
+                    construct_range(mid, std::next(mid, n - tail), old_end);
+                    for(size_type i(0); i < tail; ++i)
+                        construct(old_end + (n - tail) + i, std::move(p[i]));
+                    std::copy(first, mid, p);
+                }
+                m_end += n;
+            }
 
-        public :        
+        protected :
+            /**
+            * @brief Construtor para classes derivadas que fornecem um bloco inicial próprio (ex.: sc::small_vector). O bloco não é liberado pela lista.
+            * @param buffer              Bloco inicial (memória bruta).
+            * @param buffer_capacity     Quantidade de posições do bloco.
+            * @param alloc               Alocador usado quando a lista crescer além do bloco.
+            */
+            vector( pointer buffer, size_type buffer_capacity, const Allocator &alloc )
+                : m_end(0)
+                , m_capacity(buffer_capacity)
+                , m_storage(buffer)
+                , m_alloc(alloc)
+            { }
             /**
-            * @brief Cria uma lista vazia.
+            * @brief Indica se p é um bloco que não pertence ao alocador e, portanto, nunca deve ser liberado nem tomado por outra lista.
+            * @param p     Bloco consultado.
+            */
+            virtual bool is_external( const value_type *p ) const{
+                (void) p;
+                return false;
+            }
+            /**
+            * @brief Chamada depois que outra lista tomou o bloco desta, que ficou vazia e sem bloco. Classes derivadas com um bloco próprio (ex.: sc::small_vector) voltam a usá-lo aqui.
+            */
+            virtual void restore_buffer( void ){ }
+            /**
+            * @brief Destrói os elementos, libera o bloco atual e passa a usar buffer, um bloco externo (ex.: o buffer interno de sc::small_vector).
+            * @param buffer              Bloco (memória bruta).
+            * @param buffer_capacity     Quantidade de posições do bloco.
+            */
+            void use_buffer( pointer buffer, size_type buffer_capacity ){
+                clear();
+                deallocate(m_storage, m_capacity);
+                m_storage = buffer;
+                m_capacity = buffer_capacity;
+            }
+            /**
+            * @brief Corpo da atribuição por movimento, sem noexcept: se o bloco de other for externo, ou se os alocadores diferirem sem propagação, os elementos são movidos um a um para um bloco desta lista, o que pode alocar.
+            * @param other     Lista a ser movida (diferente desta).
+            */
+            void move_from( vector &other ){
+                bool steal = not other.is_external(other.m_storage);
+                if constexpr (not alloc_traits::propagate_on_container_move_assignment::value
+                              and not alloc_traits::is_always_equal::value)
+                    steal = steal and m_alloc == other.m_alloc;
+                if(not steal){
+                    clear();
+                    reserve(other.m_end);
+                    relocate(other.m_storage, other.m_end, m_storage);
+                    m_end = other.m_end;
+                    other.m_end = 0;
+                    other.invalidate_iterators();
+                    return;
+                }
+                clear();
+                deallocate(m_storage, m_capacity);
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                    m_alloc = std::move(other.m_alloc);
+                m_end = other.m_end;
+                m_capacity = other.m_capacity;
+                m_storage = other.m_storage;
+                take_debug_state(other);
+                other.m_end = 0;
+                other.m_capacity = 0;
+                other.m_storage = nullptr;
+                other.restore_buffer();
+            }
+            /**
+            * @brief Corpo de swap(). Blocos do alocador são trocados em O(1). Blocos externos não mudam de dono: os
+            * elementos são trocados um a um entre dois deles, ou, quando só uma das listas usa o seu, movidos para o
+            * bloco externo da outra (ver restore_buffer()), que toma o bloco do alocador. Nada é alocado; os dois
+            * blocos externos devem ter a mesma capacidade (ex.: duas sc::small_vector do mesmo tipo).
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap_storage( vector &other ){
+                using std::swap;
+                bool external = is_external(m_storage);
+                bool other_external = other.is_external(other.m_storage);
+                if(external and other_external){
+                    vector &shorter = m_end < other.m_end ? *this : other;
+                    vector &longer = m_end < other.m_end ? other : *this;
+                    for(size_type i(0); i < shorter.m_end; ++i)
+                        swap(shorter.m_storage[i], longer.m_storage[i]);
+                    shorter.relocate(longer.m_storage + shorter.m_end, longer.m_end - shorter.m_end, shorter.m_storage + shorter.m_end);
+                    swap(m_end, other.m_end);
+                    if constexpr (alloc_traits::propagate_on_container_swap::value)
+                        swap(m_alloc, other.m_alloc);
+                    invalidate_iterators();
+                    other.invalidate_iterators();
+                    return;
+                }
+                if(external or other_external){
+                    vector &inline_side = external ? *this : other;
+                    vector &heap_side = external ? other : *this;
+                    pointer block = heap_side.m_storage;
+                    size_type block_capacity = heap_side.m_capacity;
+                    size_type block_size = heap_side.m_end;
+#ifdef SC_VECTOR_DEBUG
+                    swap(m_debug, other.m_debug); // os iteradores do bloco do alocador seguem o bloco
+#endif
+                    heap_side.m_end = 0;
+                    heap_side.m_capacity = 0;
+                    heap_side.m_storage = nullptr;
+                    heap_side.restore_buffer();
+                    heap_side.relocate(inline_side.m_storage, inline_side.m_end, heap_side.m_storage);
+                    heap_side.m_end = inline_side.m_end;
+                    heap_side.invalidate_iterators();
+                    inline_side.m_end = block_size;
+                    inline_side.m_capacity = block_capacity;
+                    inline_side.m_storage = block;
+                    if constexpr (alloc_traits::propagate_on_container_swap::value)
+                        swap(m_alloc, other.m_alloc);
+                    return;
+                }
+                if constexpr (alloc_traits::propagate_on_container_swap::value)
+                    swap(m_alloc, other.m_alloc);
+                swap(m_end, other.m_end);
+                swap(m_capacity, other.m_capacity);
+                swap(m_storage, other.m_storage);
+#ifdef SC_VECTOR_DEBUG
+                swap(m_debug, other.m_debug);
+#endif
+            }
+            /**
+            * @brief Destrói os elementos e esquece o bloco atual se ele for externo. Classes derivadas chamam isto no destrutor, antes que o bloco deixe de existir.
+            */
+            void release_external( void ){
+                if(is_external(m_storage)){
+                    clear();
+                    m_storage = nullptr;
+                    m_capacity = 0;
+                }
+            }
+
+        public :
+            /**
+            * @brief Cria uma lista vazia. Nenhuma memória é alocada.
             */
             vector()
                 : m_end(0)
-                , m_capacity(1)
-                , m_storage( new T[2] )
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc()
             { }
             /**
-            * @brief Constrói a lista com instâncias inseridas por padrão de contagem de T.
+            * @brief Cria uma lista vazia que usa o alocador dado.
+            * @param alloc     Alocador.
+            */
+            explicit vector( const Allocator &alloc )
+                : m_end(0)
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc(alloc)
+            { }
+            /**
+            * @brief Cria uma lista vazia com capacidade para size_ elementos. A memória é reservada, mas nenhum objeto é construído.
             * @param size_       Tamanho da lista criada
+            * @param alloc       Alocador.
             */
-            explicit vector( size_type size_)
+            explicit vector( size_type size_, const Allocator &alloc = Allocator() )
                 : m_end(0)
-                , m_storage( new T[size_+1])
                 , m_capacity(size_)
-            {}
+                , m_storage(nullptr)
+                , m_alloc(alloc)
+            {
+                m_storage = allocate(size_);
+            }
             /**
             * @brief Destrói a lista. Os destruidores dos elementos são chamados e o armazenamento usado é alocado. Note que, se os elementos forem ponteiros, os objetos apontados não serão destruídos.
             */
             virtual ~vector( void ){
-                delete [] m_storage; 
+                count(&stats::counters::wasted_bytes, (m_capacity - m_end) * sizeof(T));
+                destroy(m_storage, m_storage + m_end);
+                deallocate(m_storage, m_capacity);
             }
 
-            template <typename InputIt>
+            template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category >
             /**
-            * @brief Constrói a lista com o conteúdo do intervalo first, last.
+            * @brief Constrói a lista com o conteúdo do intervalo first, last. Com iteradores de avanço o intervalo é medido antes e copiado em bloco para um armazenamento do tamanho exato; iteradores de entrada (ex.: std::istream_iterator) são lidos uma única vez, elemento a elemento.
             * @param first      Inicio do intevalo.
             * @param last       Fim do intervalo.
+            * @param alloc      Alocador.
             */
-            vector( InputIt &first, InputIt &last )
-                : m_end(&last - &first)
-                , m_capacity(&last - &first)
-                , m_storage( new InputIt[&last-&first+1])
+            vector( InputIt first, InputIt last, const Allocator &alloc = Allocator() )
+                : m_end(0)
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc(alloc)
             {
-                auto * temp = &first;
-                for(auto i(0); i < &last-&first; ++i){
-                    m_storage[i] = *temp;
-                    temp++;
+                if constexpr (detail::is_forward_iterator<InputIt>::value){
+                    m_capacity = std::distance(first, last);
+                    m_storage = allocate(m_capacity);
+                    try {
+                        construct_range(first, last, m_storage);
+                    } catch(...) {
+                        deallocate(m_storage, m_capacity);
+                        throw;
+                    }
+                    m_end = m_capacity;
+                } else {
+                    try {
+                        for(; first != last; ++first)
+                            emplace_back(*first);
+                    } catch(...) {
+                        destroy(m_storage, m_storage + m_end);
+                        deallocate(m_storage, m_capacity);
+                        throw;
+                    }
                 }
             }
             /**
@@ -73,154 +745,356 @@
             * @param other      Onde será copiada a lista.
             */
             vector( const vector &other)
+                : m_end(0)
+                , m_capacity(other.m_capacity)
+                , m_storage(nullptr)
+                , m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+            {
+                m_storage = allocate(m_capacity);
+                try {
+                    construct_range(other.m_storage, other.m_storage + other.m_end, m_storage);
+                } catch(...) {
+                    deallocate(m_storage, m_capacity);
+                    throw;
+                }
+                m_end = other.m_end;
+            }
+            /**
+            * @brief Um construtor de movimento. Toma posse do armazenamento de other em O(1), deixando-o vazio e sem capacidade. Nada é alocado: uma sc::small_vector, cujo buffer interno não pode ser tomado, não é um sc::vector público e é movida pelo construtor seguinte.
+            * @param other      Lista cujo armazenamento será tomado.
+            */
+            vector( vector &&other) noexcept
                 : m_end(other.m_end)
                 , m_capacity(other.m_capacity)
-                , m_storage(new T[other.m_capacity+1])
+                , m_storage(other.m_storage)
+                , m_alloc(std::move(other.m_alloc))
+            {
+                take_debug_state(other);
+                other.m_end = 0;
+                other.m_capacity = 0;
+                other.m_storage = nullptr;
+            }
+            /**
+            * @brief Um construtor de movimento a partir de uma sc::small_vector. Se ela estiver usando o buffer interno, os elementos são movidos um a um para um bloco novo (por isso não é noexcept); caso contrário, o bloco é tomado em O(1).
+            * @param other      Lista a ser movida.
+            */
+            template <std::size_t N>
+            vector( small_vector<T, N, Allocator, GrowthPolicy> &&other )
+                : vector(other.get_allocator())
+            {
+                move_from(other);
+            }
+            /**
+            * @brief Um construtor de cópia que usa o alocador dado (ex.: copiar uma lista para dentro de uma sc::arena).
+            * @param other      Onde será copiada a lista.
+            * @param alloc      Alocador da nova lista.
+            */
+            vector( const vector &other, const Allocator &alloc )
+                : m_end(0)
+                , m_capacity(other.m_end)
+                , m_storage(nullptr)
+                , m_alloc(alloc)
+            {
+                m_storage = allocate(m_capacity);
+                try {
+                    construct_range(other.m_storage, other.m_storage + other.m_end, m_storage);
+                } catch(...) {
+                    deallocate(m_storage, m_capacity);
+                    throw;
+                }
+                m_end = other.m_end;
+            }
+            /**
+            * @brief Um construtor de movimento que usa o alocador dado, qualquer que seja a propagação do alocador. Se ele for igual ao de other, o armazenamento é tomado em O(1); caso contrário, os elementos são movidos um a um para um bloco obtido de alloc.
+            * @param other      Lista a ser movida.
+            * @param alloc      Alocador da nova lista.
+            */
+            vector( vector &&other, const Allocator &alloc )
+                : m_end(0)
+                , m_capacity(0)
+                , m_storage(nullptr)
+                , m_alloc(alloc)
             {
-                for(int i(0); i < m_end; ++i)
-                    m_storage[i] = other.m_storage[i];
+                if(alloc_traits::is_always_equal::value or m_alloc == other.m_alloc){
+                    m_end = other.m_end;
+                    m_capacity = other.m_capacity;
+                    m_storage = other.m_storage;
+                    take_debug_state(other);
+                    other.m_end = 0;
+                    other.m_capacity = 0;
+                    other.m_storage = nullptr;
+                    return;
+                }
+                m_storage = allocate(other.m_end);
+                m_capacity = other.m_end;
+                try {
+                    relocate(other.m_storage, other.m_end, m_storage);
+                } catch(...) {
+                    deallocate(m_storage, m_capacity);
+                    throw;
+                }
+                m_end = other.m_end;
+                other.m_end = 0;
+                other.invalidate_iterators();
             }
             /**
             * @brief Constrói a lista com o conteúdo da lista de inicializadores.
             * @param list     Lista de inicializadores.
+            * @param alloc    Alocador.
             */
-            vector( std::initializer_list<T> list)
-                : m_end(list.size())
-                , m_capacity(list.size())
-                , m_storage(new T[list.size()+1])
+            vector( std::initializer_list<T> list, const Allocator &alloc = Allocator() )
+                : vector(list.begin(), list.end(), alloc)
             {}
             /**
             * @brief Copiar operador de atribuição. Substitui o conteúdo por uma cópia do conteúdo de outro.
             * @param other     O que será copiado
             */
             vector& operator =( const vector &other){
-                m_capacity = other.m_capacity;
-                m_end = other.m_end;
-                m_storage = new T[other.m_capacity+1];
+                if(this == &other)
+                    return *this;
 
-                for(int i(0); i < m_end; ++i)
-                    m_storage[i] = other.m_storage[i];
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value){
+                    if(m_alloc != other.m_alloc){
+                        clear();
+                        deallocate(m_storage, m_capacity);
+                        m_storage = nullptr;
+                        m_capacity = 0;
+                    }
+                    m_alloc = other.m_alloc;
+                }
+                assign_range(other.m_storage, other.m_end);
+                return *this;
+            }
+            /**
+            * @brief Operador de atribuição por movimento. Libera o conteúdo atual e toma posse do armazenamento de other em O(1), deixando-o vazio e sem capacidade. Se o alocador não se propaga e os alocadores diferem, os elementos são movidos um a um.
+            * @param other     O que será movido
+            */
+            vector& operator =( vector &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                                                         or alloc_traits::is_always_equal::value){
+                if(this != &other)
+                    move_from(other);
+                return *this;
             }
             /**
+            * @brief Operador de atribuição por movimento a partir de uma sc::small_vector. Se ela estiver usando o buffer interno, os elementos são movidos um a um para um bloco desta lista (por isso não é noexcept); caso contrário, o bloco é tomado em O(1).
+            * @param other     O que será movido
+            */
+            template <std::size_t N>
+            vector& operator =( small_vector<T, N, Allocator, GrowthPolicy> &&other ){
+                move_from(other);
+                return *this;
+            }
+                        /**
             * @brief Substitui o conteúdo por aqueles identificados pela lista de inicializadores.
             * @param list     Lista de inicializadores.
             */
             vector& operator =(std::initializer_list <T> list){
-                while(m_capacity < list.size()){
-                    m_capacity *= 2;
-                }
-                m_end = list.size();
+                assign(list);
+                return *this;
+            }
 
-                std::copy(list.begin(), list.end(), m_storage);
+            /**
+            * @brief Retorna uma cópia do alocador associado à lista.
+            */
+            allocator_type get_allocator( void ) const{
+                return m_alloc;
+            }
+
+            /**
+            * @brief Troca o conteúdo com o de other em O(1), sem copiar ou mover elementos. Uma sc::small_vector, que não é um sc::vector público, é trocada por small_vector::swap, que move os elementos do buffer interno.
+            * @param other     Lista com a qual o conteúdo será trocado.
+            */
+            void swap( vector &other) noexcept{
+                swap_storage(other);
             }
 
-            
-            bool full( void ) { 
-                return m_end == m_capacity; 
+            bool full( void ) {
+                return m_end == m_capacity;
             }
             /**
             * @brief Retorna o número de elementos no container.
             */
             size_type size( void ) const{
-                return m_end; 
+                return m_end;
             }
             /**
-            * @brief Remove (logicamente ou fisicamente) todos os elementos do container.
+            * @brief Remove todos os elementos do container, chamando seus destruidores. A capacidade não é alterada (exceto com a política growth::trimmed, que encolhe o bloco até o mínimo da política).
             */
             void clear( void ) {
-                m_end = 0; 
+                invalidate_iterators();
+                destroy(m_storage, m_storage + m_end);
+                m_end = 0;
+                auto_trim();
             }
             /**
             * @brief Retorna true se o container não contiver nenhum elemento, e false caso contrário.
             */
             bool empty( void ) const {
-                return m_end == 0; 
+                return m_end == 0;
             }
             /**
-            * @brief Adiciona um valor no inicio da lista.
+            * @brief Adiciona um valor no inicio da lista. Custa O(n), pois desloca todos os elementos; para inserções frequentes no inicio use sc::devector.
             * @param value     Valor a ser adicionado.
             */
             void push_front( const_reference value){
-                if(full() and m_capacity != 0){
-                    m_capacity *= 2;
-                    T * m_storage_move = new T[m_capacity];
-                    for(int i(0); i < m_end; ++i){
-                        m_storage_move[i] = m_storage[i];
-                    }
-                    m_storage = m_storage_move;
-                }else if(m_capacity == 0)
-                    m_capacity = 1;
-
-                m_end++;
-            
-                auto aux1 = m_end, aux2 = m_end;
-                for(auto i(1); i < m_end; ++i){
-                    if(i == 1){
-                        aux1 = m_storage[i];
-                        m_storage[i] = m_storage[i-1];
-                    } else {
-                        aux2 = m_storage[i];
-                        m_storage[i] = aux1;
-                        aux1 = aux2;
-                    }
-
-                }
-                m_storage[0] = value;
+                emplace(begin(), value);
+            }
+            /**
+            * @brief Adiciona um valor no inicio da lista, movendo-o.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_front( value_type &&value){
+                emplace(begin(), std::move(value));
+            }
+            /**
+            * @brief Constrói um valor no inicio da lista a partir dos argumentos dados.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            reference emplace_front( Args&&... args){
+                return *emplace(begin(), std::forward<Args>(args)...);
             }
             /**
             * @brief Adiciona um valor ao final da lista.
             * @param value     Valor a ser adicionado.
             */
             void push_back( const_reference value){
-                if(full() and m_capacity != 0){
-                    m_capacity *= 2;
-                    T * m_storage_move = new T[m_capacity];
-                    for(int i(0); i < m_end; ++i){
-                        m_storage_move[i] = m_storage[i];
-                    }
-                    m_storage = m_storage_move;
-                }else if(m_capacity == 0)
-                    m_capacity = 1;
-
-                m_storage[m_end++] = value; 
+                emplace_back(value);
+            }
+            /**
+            * @brief Adiciona um valor ao final da lista, movendo-o.
+            * @param value     Valor a ser adicionado.
+            */
+            void push_back( value_type &&value){
+                emplace_back(std::move(value));
+            }
+            /**
+            * @brief Constrói um valor diretamente no final da lista a partir dos argumentos dados, sem objeto temporário.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            reference emplace_back( Args&&... args){
+                if(full())
+                    reallocate_append(next_capacity(m_end + 1), std::forward<Args>(args)...);
+                else
+                    construct(m_storage + m_end, std::forward<Args>(args)...);
+                return m_storage[m_end++];
+            }
+            /**
+            * @brief Acrescenta ao final cópias dos elementos do intervalo first-last. Com iteradores de avanço o tamanho é
+            * medido antes, a lista cresce no máximo uma vez e a cópia é feita em bloco (memcpy para tipos trivialmente
+            * copiáveis vindos de memória contígua); o intervalo pode ser parte da própria lista.
+            * @param first     Inicio do intervalo.
+            * @param last      Fim do intervalo.
+            */
+            template < typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category >
+            void append_range( InputItr first, InputItr last){
+                using category = typename std::iterator_traits<InputItr>::iterator_category;
+                if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value){
+                    size_type n = std::distance(first, last);
+                    append_with(n, [&]( pointer dest ){ construct_range(first, last, dest); });
+                } else {
+                    for(; first != last; ++first)
+                        emplace_back(*first);
+                }
+            }
+            /**
+            * @brief Acrescenta ao final cópias dos n elementos a partir de values (por exemplo, um buffer recebido da rede).
+            * @param values     Início dos elementos.
+            * @param n          Quantidade de elementos.
+            */
+            void append( const T *values, size_type n){
+                append_with(n, [&]( pointer dest ){ construct_range(values, values + n, dest); });
+            }
+            /**
+            * @brief Altera o tamanho da lista para n: remove os últimos elementos ou acrescenta elementos inicializados por valor (zerados, para tipos triviais).
+            * @param n     Novo tamanho.
+            */
+            void resize( size_type n){
+                if(n <= m_end){
+                    destroy(m_storage + n, m_storage + m_end);
+                    m_end = n;
+                    auto_trim();
+                } else {
+                    size_type added = n - m_end;
+                    append_with(added, [&]( pointer dest ){ construct_default(dest, added); });
+                }
+            }
+            /**
+            * @brief Altera o tamanho da lista para n: remove os últimos elementos ou acrescenta cópias de value.
+            * @param n         Novo tamanho.
+            * @param value     Valor dos elementos acrescentados (pode ser um elemento da lista).
+            */
+            void resize( size_type n, const_reference value){
+                if(n <= m_end){
+                    destroy(m_storage + n, m_storage + m_end);
+                    m_end = n;
+                    auto_trim();
+                } else {
+                    size_type added = n - m_end;
+                    append_with(added, [&]( pointer dest ){ construct_fill(dest, added, value); });
+                }
+            }
+            /**
+            * @brief Como resize(n), mas os elementos acrescentados de tipos triviais não são inicializados: servem para
+            * serem sobrescritos em seguida (por read(), memcpy, um decodificador) sem pagar por zerá-los antes. Tipos não
+            * triviais são inicializados por valor.
+            * @param n     Novo tamanho.
+            */
+            void resize_for_overwrite( size_type n){
+                if constexpr (std::is_trivially_default_constructible<T>::value and std::is_trivially_copyable<T>::value){
+                    if(n <= m_end){
+                        m_end = n;
+                        auto_trim();
+                    } else
+                        append_with(n - m_end, []( pointer ){ });
+                } else
+                    resize(n);
             }
             /**
             * @brief Remove o objeto no final da lista.
             */
             void pop_back( void ){
+                SC_DEBUG_CHECK(m_end != 0, "pop_back() on an empty vector");
                 m_end--;
+                destroy(m_storage + m_end, m_storage + m_end + 1);
+                auto_trim();
             }
             /**
             * @brief Remove o objeto no inicio da lista.
             */
             void pop_front( void ){
-                for(auto i(0); i+1 < m_end; ++i){
-                    m_storage[i] = m_storage[i+1];
-                }
-                m_end--;
+                SC_DEBUG_CHECK(m_end != 0, "pop_front() on an empty vector");
+                count(&stats::counters::elements_shifted, m_end - 1);
+                std::move(m_storage + 1, m_storage + m_end, m_storage);
+                pop_back();
             }
             /**
             * @brief Retorna o objeto no final da lista.
             */
-            const_reference back( void ) const{ 
+            const_reference back( void ) const{
+                SC_DEBUG_CHECK(m_end != 0, "back() on an empty vector");
                 return m_storage[m_end-1];
             }
             /**
             * @brief Retorna o objeto no final da lista.
             */
             reference back( void ){
+                SC_DEBUG_CHECK(m_end != 0, "back() on an empty vector");
                 return m_storage[m_end-1];
             }
             /**
             * @brief Retorna o objeto no inicio da lista.
             */
-            const_reference front( void ) const{ 
+            const_reference front( void ) const{
+                SC_DEBUG_CHECK(m_end != 0, "front() on an empty vector");
                 return m_storage[0];
             }
             /**
             * @brief Retorna o objeto no inicio da lista.
             */
-            reference front( void ){ 
+            reference front( void ){
+                SC_DEBUG_CHECK(m_end != 0, "front() on an empty vector");
                 return m_storage[0];
             }
             /**
@@ -228,45 +1102,58 @@
             * @param value     Valor que vai substituir.
             */
             void assign( size_type count, const_reference value){
-                clear();
-                m_end = count;
-                if(m_end > m_capacity){
-                    m_capacity *= 2;
-                    m_storage = new T[m_capacity];
+                if(count > m_capacity){
+                    // Constrói no bloco novo antes de destruir o antigo: value pode ser um dos elementos.
+                    pointer new_storage = allocate(count);
+                    try {
+                        construct_fill(new_storage, count, value);
+                    } catch(...) {
+                        deallocate(new_storage, count);
+                        throw;
+                    }
+                    destroy(m_storage, m_storage + m_end);
+                    deallocate(m_storage, m_capacity);
+                    m_storage = new_storage;
+                    m_capacity = count;
+                    vector::count(&stats::counters::reallocations, 1);
+                } else if(count > m_end){
+                    detail::fill_n<parallel_writes>(m_storage, m_end, value);
+                    construct_fill(m_storage + m_end, count - m_end, value);
+                } else {
+                    detail::fill_n<parallel_writes>(m_storage, count, value);
+                    destroy(m_storage + count, m_storage + m_end);
                 }
-
-                for(int i(0); i < m_end; ++i)
-                    m_storage[i] = value;
+                m_end = count;
             }
             /**
             * @brief Substitui o conteúdo de a lista com os elementos da lista de inicializadores.
             * @param list     Lista de inicializadores.
             */
             void assign( const std::initializer_list<T>& list){
-                clear();
-                m_end = list.size();
-
-                std::copy(list.begin(), list.end(), m_storage);
+                assign_range(list.begin(), list.size());
             }
 
-            template < typename InputItr >
+            template < typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category >
             /**
-            * @brief Substitui o conteúdo da lista por cópias dos elementos no intervalo First-Last.
+            * @brief Substitui o conteúdo da lista por cópias dos elementos no intervalo First-Last. Iteradores de entrada são lidos uma única vez, elemento a elemento.
             * @param First    Inicio do intervalo.
             * @param Last     FIm do intervalo.
             */
             void assign( InputItr first, InputItr last){
-                clear();
-                auto size = std::distance(&first, &last);
-                m_end = size;
-
-                std::copy(&first, &last, m_storage);
+                if constexpr (detail::is_forward_iterator<InputItr>::value)
+                    assign_range(first, std::distance(first, last));
+                else {
+                    clear();
+                    for(; first != last; ++first)
+                        emplace_back(*first);
+                }
             }
             /**
             * @brief Retorna o objeto na posição do índice na matriz, sem verificação de limites.
             * @param pos     Posição do indice.
             */
             const_reference operator[]( size_type pos ) const{
+                SC_DEBUG_CHECK(pos < m_end, "operator[] index out of range");
                 return m_storage[pos];
             }
             /**
@@ -274,7 +1161,8 @@
             * @param pos     Posição do indice.
             */
             reference operator[]( size_type pos ) {
-                return m_storage[pos]; 
+                SC_DEBUG_CHECK(pos < m_end, "operator[] index out of range");
+                return m_storage[pos];
             }
             /**
             * @brief retorna o objeto na posição do índice na matriz, com verificação de limites. Se pos não estiver dentro do intervalo da lista, uma exceção do tipo std :: out_of_range é lançado.
@@ -283,7 +1171,7 @@
             const_reference at( size_type pos ) const{
                 if(pos < 0 or pos >= m_end)
                     throw std::out_of_range("[at()] Cannot recover an element out of the range");
-                else 
+                else
                     return m_storage[pos];
             }
             /**
@@ -293,224 +1181,251 @@
             reference at( size_type pos){
                 if(pos < 0 or pos >= m_end)
                     throw std::out_of_range("[at()] Cannot recover an element out of the range");
-                else 
+                else
                     return m_storage[pos];
             }
             /**
             * @brief Retorna a capacidade de armazenamento interno da matriz.
             */
-            size_type capacity( void ) const{ 
-                return m_capacity; 
+            size_type capacity( void ) const{
+                return m_capacity;
             }
             /**
-            * @brief Aumenta a capacidade de armazenamento do array para um valor maior ou igual a new_cap.
+            * @brief Aumenta a capacidade de armazenamento do array para um valor maior ou igual a new_cap. Nenhum objeto novo é construído.
             * @param new_cap     Novo valor da capacidade de armazenamento do array.
             */
             void reserve( size_type new_cap){
-                if(new_cap > m_capacity){
-                    m_capacity = new_cap;
-                    T * m_storage_move = new T[m_capacity];
-                    for(int i(0); i < m_end; ++i){
-                        m_storage_move[i] = m_storage[i];
-                    }
-                    m_storage = m_storage_move;
-                }
+                if(new_cap > m_capacity)
+                    reallocate(new_cap);
             }
             /**
-            * @brief Solicita a remoção da capacidade não utilizada.
+            * @brief Troca o bloco por um com exatamente size() posições, movendo os elementos, e libera o antigo. O buffer
+            * interno de sc::small_vector nunca é trocado (ele não ocupa memória do alocador).
             */
-            void shrink_to_fit( void ){ 
-                m_capacity = m_end; 
+            void shrink_to_fit( void ){
+                if(m_end < m_capacity and not is_external(m_storage))
+                    reallocate(m_end);
             }
             /**
-            * @brief Verifica se o conteúdo de lhs é igual ao de outra lista.
-            * @param lhs     Lista.
+            * @brief Devolve a memória ociosa se size() for menor que threshold * capacity(). Blocos comuns são trocados
+            * por um do tamanho exato (como shrink_to_fit). Blocos do std::allocator a partir de
+            * growth::release_in_place_bytes não são copiados: as páginas além do último elemento voltam ao sistema com
+            * madvise(MADV_DONTNEED) e capacity() não muda (o espaço de endereços continua reservado e é repovoado sob
+            * demanda ao crescer). O buffer interno de sc::small_vector nunca é trocado.
+            * @param threshold     Fração da capacidade abaixo da qual a memória é devolvida.
             */
-            bool operator==( const vector &lhs){
-                if(lhs.size() != m_end)
-                    return false;
-                else {
-                    for(int i(0); i < lhs.m_end; ++i){
-                        if(lhs[i] != m_storage[i])
-                            return false;
+            void trim( double threshold = 0.5 ){
+                if(is_external(m_storage) or not (m_end < threshold * m_capacity))
+                    return;
+                if constexpr (std::is_same<Allocator, std::allocator<T> >::value){
+                    if(m_capacity * sizeof(T) >= growth::release_in_place_bytes){
+                        detail::release_pages(m_storage + m_end, m_storage + m_capacity);
+                        return;
                     }
                 }
-                return true;
+                reallocate(m_end);
+            }
+            /**
+            * @brief Verifica se o conteúdo de lhs é igual ao de outra lista. Para tipos aritméticos a comparação é vetorizada (ver simd.h).
+            * @param lhs     Lista.
+            */
+            bool operator==( const vector &lhs) const{
+                return lhs.m_end == m_end and simd::equal(lhs.m_storage, m_storage, m_end);
             }
             /**
             * @brief Verifica se o conteúdo de lhs é igual ao de outra lista (de forma inversa ao anterior).
-            * @param lhs     Lista.            
+            * @param lhs     Lista.
             */
-            bool operator!=( const vector &lhs){
-                if(lhs.size() != m_end)
-                    return true;
-
-                for(int i(0); i < lhs.m_end; ++i){
-                    if(lhs[i] != m_storage[i])
-                        return true;
-                }
-                return false;
+            bool operator!=( const vector &lhs) const{
+                return not (*this == lhs);
             }
 
             /**
-            * @brief Retorna um iterador apontando para o primeiro item da lista. 
+            * @brief Retorna um iterador apontando para o primeiro item da lista.
             */
             iterator begin( void ){
-                return iterator( &m_storage[0]);
+                return make_iterator( m_storage );
+            }
+            /**
+            * @brief Retorna um iterador constante apontando para o primeiro item na lista.
+            */
+            const_iterator begin( void ) const{
+                return make_iterator( m_storage );
             }
             /**
             * @brief Retorna um iterador constante apontando para o primeiro item na lista.
             */
             const_iterator cbegin( void ) const{
-                return const_iterator( &m_storage[0]);
+                return make_iterator( m_storage );
             }
             /**
             * @brief Retorna um iterador apontando para a marca final na lista, isto é, a posição logo após o último elemento da lista.
             */
             iterator end( void ){
-                return iterator( &m_storage[m_end]);
+                return make_iterator( m_storage + m_end );
+            }
+            /**
+            * @brief retorna um iterador constante apontando para a marca final na lista, ou seja, a posição logo após o último elemento da lista.
+            */
+            const_iterator end( void ) const{
+                return make_iterator( m_storage + m_end );
             }
             /**
             * @brief retorna um iterador constante apontando para a marca final na lista, ou seja, a posição logo após o último elemento da lista.
             */
             const_iterator cend( void ) const{
-                return const_iterator( &m_storage[m_end]);
+                return make_iterator( m_storage + m_end );
             }
 
             /**
             * @brief Adiciona valor a lista antes da posição dada pelo iterador x. O método retorna um iterador a posição do item inserido.
             * @param x     Posição dada pelo Iterador.
-            * @param y     Valor a ser adicionado.         
+            * @param y     Valor a ser adicionado.
+            */
+            iterator insert(const_iterator x, const_reference y){
+                return emplace(x, y);
+            }
+            /**
+            * @brief Adiciona valor a lista antes da posição dada pelo iterador x, movendo-o. O método retorna um iterador a posição do item inserido.
+            * @param x     Posição dada pelo Iterador.
+            * @param y     Valor a ser adicionado.
             */
-            iterator insert(iterator x, const_reference y){
+            iterator insert(const_iterator x, value_type &&y){
+                return emplace(x, std::move(y));
+            }
+            /**
+            * @brief Constrói um valor antes da posição dada pelo iterador x a partir dos argumentos dados. O método retorna um iterador a posição do item inserido.
+            * @param x        Posição dada pelo Iterador.
+            * @param args     Argumentos do construtor de T.
+            */
+            template <typename... Args>
+            iterator emplace(const_iterator x, Args&&... args){
+                check_iterator(x);
 
-                std::ptrdiff_t i = x - begin();
+                size_type i = x - cbegin();
 
                 if (i > m_end){
                     return begin();
                 }
-                reserve(m_end + 1);
-                m_end++;
-                iterator new_x = begin() + i;
-                iterator end(&m_storage[m_end - 1]);
+                if (i == m_end){
+                    emplace_back(std::forward<Args>(args)...);
+                    return begin() + i;
+                }
+                value_type value(std::forward<Args>(args)...); // args podem referenciar elementos deslocados abaixo
+                if(full())
+                    reallocate(next_capacity(m_end + 1));
+                count(&stats::counters::elements_shifted, m_end - i);
 
-                while (end != new_x){
-                    *end = *(end - 1);
-                    end--;
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    std::memmove(static_cast<void*>(m_storage + i + 1), static_cast<const void*>(m_storage + i), (m_end - i) * sizeof(T));
+                    construct(m_storage + i, std::move(value));
+                } else {
+                    construct(m_storage + m_end, std::move(m_storage[m_end-1]));
+                    std::move_backward(m_storage + i, m_storage + m_end - 1, m_storage + m_end);
+                    m_storage[i] = std::move(value);
                 }
-                *end = y;
-                return new_x;
+                m_end++;
+                return begin() + i;
             }
 
             template < typename InputItr >
             /**
-            * @brief Insere a partir do intervalo Inicio-Fim antes da posição dada pelo iterador x.
+            * @brief Insere a partir do intervalo Inicio-Fim antes da posição dada pelo iterador x. Iteradores de entrada são lidos uma única vez: os elementos são acrescentados ao final e depois girados para a posição.
             * @param x     Posição dada pelo Iterador.
-            * @param inicio     Inicio do intervalo.         
-            * @param fim     Fim do intervalo.         
+            * @param inicio     Inicio do intervalo.
+            * @param fim     Fim do intervalo.
             */
-            iterator insert(iterator x, InputItr inicio, InputItr fim){
+            iterator insert(const_iterator x, InputItr inicio, InputItr fim){
+                check_iterator(x);
 
-                std::ptrdiff_t i = x - begin();
+                size_type i = x - cbegin();
 
                 if (i > m_end){
                     return begin();
                 }
 
-                int dist = std::distance(inicio, fim);
-                reserve(m_end + dist);
-                m_end += dist;
-
-                iterator new_x = begin() + i;
-                iterator old_end = end() - (dist + 1);
-                iterator end(&m_storage[m_end - 1]);
-
-                while (old_end != (new_x - 1)){
-                    *end = *old_end;
-                    old_end--;
-                    end--;
-                }
-                fim--;
-                while (fim != (inicio - 1)){
-                    *end = *fim;
-                    fim--;
-                    end--;
+                if constexpr (detail::is_forward_iterator<InputItr>::value)
+                    insert_range(i, inicio, std::distance(inicio, fim));
+                else {
+                    size_type old_end = m_end;
+                    try {
+                        for(; inicio != fim; ++inicio)
+                            emplace_back(*inicio);
+                    } catch(...) {
+                        destroy(m_storage + old_end, m_storage + m_end);
+                        m_end = old_end;
+                        throw;
+                    }
+                    count(&stats::counters::elements_shifted, old_end - i);
+                    std::rotate(m_storage + i, m_storage + old_end, m_storage + m_end);
                 }
-                return new_x;
+                return begin() + i;
             }
             /**
             * @brief Insere elementos da lista inicializadora lista antes da posição dada pelo iterador it.
             * @param it     Posição dada pelo Iterador.
-            * @param lista     LIsta inicializadora.         
+            * @param lista     LIsta inicializadora.
             */
-            iterator insert(iterator it, const std::initializer_list<value_type> &lista){
+            iterator insert(const_iterator it, const std::initializer_list<value_type> &lista){
+                check_iterator(it);
 
-                std::ptrdiff_t i = it - begin();
+                size_type i = it - cbegin();
 
                 if (i > m_end){
                     return begin();
                 }
 
-                int size = lista.size();
-                reserve(m_end + size);
-                m_end += size;
-                iterator new_pos = begin() + i;
-                iterator old_end = end() - (size + 1);
-                iterator end(&m_storage[m_end - 1]);
-                while (old_end != (new_pos - 1)){
-                    *end = *old_end;
-                    old_end--;
-                    end--;
-                }
-
-                auto x = lista.begin();
-                auto y = lista.end() - 1;
-                while (y != (x - 1)){
-                    *end = *y;
-                    end--;
-                    y--;
-                }
-                return new_pos;
+                insert_range(i, lista.begin(), lista.size());
+                return begin() + i;
             }
             /**
-            * @brief Remove elementos no intervalo x-y. 
+            * @brief Remove elementos no intervalo x-y.
             * @param x     Inicio do intervalo.
-            * @param y     Fim do intervalo.         
+            * @param y     Fim do intervalo.
             */
-            iterator erase(iterator x, iterator y){
-                iterator passado_y = x;
-                iterator atual_y = y;
+            iterator erase(const_iterator x, const_iterator y){
+                check_iterator(x);
+                check_iterator(y);
+                size_type first = x - cbegin();
+                size_type last = y - cbegin();
+                count(&stats::counters::elements_shifted, m_end - last);
 
-                while (x != atual_y){
-                    *x = *y;
-                    m_end--;
-                    x++;
-                    y++;
+                if constexpr (std::is_trivially_copyable<T>::value){
+                    // Não há destrutores a chamar: um único memmove fecha o buraco.
+                    if(last != m_end)
+                        std::memmove(static_cast<void*>(m_storage + first), static_cast<const void*>(m_storage + last), (m_end - last) * sizeof(T));
+                } else {
+                    std::move(m_storage + last, m_storage + m_end, m_storage + first);
+                    destroy(m_storage + m_end - (last - first), m_storage + m_end);
                 }
-                return passado_y;
+                m_end -= last - first;
+                auto_trim();
+                return begin() + first;
             }
             /**
             * @brief Remove o objeto na posição x.
-            * @param x     Posição dada pelo Iterador.      
+            * @param x     Posição dada pelo Iterador.
             */
-            iterator erase(iterator x){
-                iterator passado_last = x;
-
-                while (x != end()){
-                    *x = *(x + 1);
-                    x++;
-                }
-
-                m_end--;
-                return passado_last;
+            iterator erase(const_iterator x){
+                return erase(x, x + 1);
             }
 
             // [V] Element access
 
-            pointer data( void );
-            const_reference data( void ) const;
+            /**
+            * @brief Retorna um ponteiro para o primeiro elemento; os size() elementos são contíguos a partir dele.
+            */
+            pointer data( void ){
+                return m_storage;
+            }
+            /**
+            * @brief Retorna um ponteiro constante para o primeiro elemento.
+            */
+            const value_type * data( void ) const{
+                return m_storage;
+            }
+
 
-            
             void print(){
 
                 std::cout << "[ ";
@@ -521,4 +1436,73 @@
                 std::cout << "]\n" << m_capacity << std::endl;
             }
         };
-    }
\ No newline at end of file
+
+        /**
+        * @brief Troca o conteúdo de duas listas em O(1).
+        * @param lhs     Primeira lista.
+        * @param rhs     Segunda lista.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        void swap( vector<T, Allocator, GrowthPolicy> &lhs, vector<T, Allocator, GrowthPolicy> &rhs ) noexcept{
+            lhs.swap(rhs);
+        }
+
+        // Buscas sobre o conteúdo da lista, vetorizadas para tipos aritméticos (ver simd.h).
+
+        /**
+        * @brief Retorna um iterador para o primeiro elemento igual a value, ou end() se não houver.
+        * @param vec       Lista.
+        * @param value     Valor procurado.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        typename vector<T, Allocator, GrowthPolicy>::const_iterator find( const vector<T, Allocator, GrowthPolicy> &vec, const T &value ){
+            return vec.cbegin() + simd::find(vec.data(), vec.size(), value);
+        }
+        /**
+        * @brief Retorna quantos elementos são iguais a value.
+        * @param vec       Lista.
+        * @param value     Valor procurado.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        std::size_t count( const vector<T, Allocator, GrowthPolicy> &vec, const T &value ){
+            return simd::count(vec.data(), vec.size(), value);
+        }
+        /**
+        * @brief Retorna o menor elemento. Se a lista estiver vazia, uma exceção do tipo std::out_of_range é lançada.
+        * @param vec     Lista.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        T min( const vector<T, Allocator, GrowthPolicy> &vec ){
+            if(vec.empty())
+                throw std::out_of_range("[min()] Cannot recover the minimum of an empty vector");
+            return simd::min(vec.data(), vec.size());
+        }
+        /**
+        * @brief Retorna o maior elemento. Se a lista estiver vazia, uma exceção do tipo std::out_of_range é lançada.
+        * @param vec     Lista.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        T max( const vector<T, Allocator, GrowthPolicy> &vec ){
+            if(vec.empty())
+                throw std::out_of_range("[max()] Cannot recover the maximum of an empty vector");
+            return simd::max(vec.data(), vec.size());
+        }
+        /**
+        * @brief Retorna a soma dos elementos; inteiros são acumulados em 64 bits (ver simd::sum_type).
+        * @param vec     Lista.
+        */
+        template <typename T, typename Allocator, typename GrowthPolicy>
+        simd::sum_type<T> sum( const vector<T, Allocator, GrowthPolicy> &vec ){
+            return simd::sum(vec.data(), vec.size());
+        }
+
+        namespace pmr{
+            /**
+            * @brief sc::vector que obtém memória de um std::pmr::memory_resource (ex.: sc::arena), escolhido em tempo de execução.
+            */
+            template <typename T, typename GrowthPolicy = growth::default_policy >
+            using vector = sc::vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+        }
+    }
+
+#endif
@@ -0,0 +1,70 @@
+#include <cstdint>              // std::uintptr_t
+#include <numeric>              // std::iota
+#include <string>               // std::string
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/aligned_allocator.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING ALIGNED_ALLOCATOR
+// ============================================================================
+
+static std::uintptr_t address( const void * p ) { return reinterpret_cast<std::uintptr_t>( p ); }
+
+TEST(AlignedAllocator, CacheLineAlignedBlocks)
+{
+    sc::aligned_vector<char> vec;
+    for ( auto i{0} ; i < 1000 ; ++i )
+    {
+        vec.push_back( static_cast<char>( i ) );
+        // Every block, whatever its size, starts on a cache line.
+        ASSERT_EQ( address( vec.data() ) % 64, 0u );
+    }
+    ASSERT_EQ( vec[999], static_cast<char>( 999 ) );
+
+    // Wider alignments, and element types that need the allocator rebound.
+    sc::vector<double, sc::aligned_allocator<double, 128> > wide;
+    wide.assign( 3, 1.5 );
+    ASSERT_EQ( address( wide.data() ) % 128, 0u );
+
+    sc::aligned_vector<std::string> words{ "a", "b" };
+    words.push_back( "c" );
+    ASSERT_EQ( address( words.data() ) % 64, 0u );
+    ASSERT_EQ( words[2], "c" );
+}
+
+TEST(AlignedAllocator, HugeBlocks)
+{
+    using allocator = sc::aligned_allocator<int>;
+    allocator alloc;
+    // Below the threshold: cache line alignment only is promised.
+    int * small = alloc.allocate( 10 );
+    ASSERT_EQ( address( small ) % 64, 0u );
+    alloc.deallocate( small, 10 );
+
+    // From 2 MB on the block is aligned to a huge page.
+    const std::size_t n = allocator::huge_page_bytes / sizeof( int ) + 1;
+    int * big = alloc.allocate( n );
+    ASSERT_EQ( address( big ) % allocator::huge_page_bytes, 0u );
+    big[n - 1] = 42;
+    ASSERT_EQ( big[n - 1], 42 );
+    alloc.deallocate( big, n );
+
+    ASSERT_TRUE( alloc == sc::aligned_allocator<long>() );
+}
+
+TEST(AlignedAllocator, HugeVector)
+{
+    sc::huge_vector<long> vec;
+    vec.resize( 1000000 );
+    // Capacity rounded to whole 2 MB pages, and the block aligned to one.
+    ASSERT_EQ( ( vec.capacity() * sizeof( long ) ) % ( 2 * 1024 * 1024 ), 0u );
+    ASSERT_EQ( address( vec.data() ) % ( 2 * 1024 * 1024 ), 0u );
+    ASSERT_EQ( vec[999999], 0 );
+
+    std::iota( vec.begin(), vec.end(), 0L );
+    vec.push_back( -1 );
+    ASSERT_EQ( vec[123456], 123456 );
+    ASSERT_EQ( vec.back(), -1 );
+}
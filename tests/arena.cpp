@@ -0,0 +1,178 @@
+#include <memory_resource>      // std::pmr::polymorphic_allocator
+#include <string>               // std::string
+#include <type_traits>          // std::true_type
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/arena.h"   // header file for tested functions
+#include "../include/devector.h" // header file for tested functions
+#include "../include/vector.h"  // header file for tested functions
+
+
+// ============================================================================
+// TESTING VECTOR ON TOP OF AN ARENA (POLYMORPHIC MEMORY RESOURCE)
+// ============================================================================
+
+// Upstream resource that counts what the arena asks for.
+class CountingResource : public std::pmr::memory_resource
+{
+    public:
+        int allocations{0};
+        int deallocations{0};
+
+    protected:
+        void * do_allocate( std::size_t bytes, std::size_t alignment ) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+        }
+        void do_deallocate( void * p, std::size_t bytes, std::size_t alignment ) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate( p, bytes, alignment );
+        }
+        bool do_is_equal( const std::pmr::memory_resource & other ) const noexcept override
+        { return this == &other; }
+};
+
+TEST(Arena, VectorUsesArena)
+{
+    CountingResource upstream;
+    {
+        sc::arena scope( 1024, &upstream );
+        sc::pmr::vector<int> vec( &scope );
+
+        for ( auto i{0} ; i < 1000 ; ++i )
+            vec.push_back( i );
+        for ( auto i{0u} ; i < vec.size() ; ++i )
+            ASSERT_EQ( vec[i], i );
+
+        // Every growth step was a bump allocation inside a handful of blocks.
+        EXPECT_LE( upstream.allocations, 4 );
+        EXPECT_EQ( upstream.deallocations, 0 );
+        EXPECT_GE( scope.bytes_allocated(), 1000 * sizeof(int) );
+    }
+    // All blocks are released together.
+    EXPECT_EQ( upstream.deallocations, upstream.allocations );
+}
+
+TEST(Arena, ManyShortLivedVectors)
+{
+    CountingResource upstream;
+    sc::arena scope( 4096, &upstream );
+
+    for ( auto round{0} ; round < 100 ; ++round )
+    {
+        sc::pmr::vector<std::string> vec( &scope );
+        vec.reserve( 8 );
+        for ( auto i{0} ; i < 8 ; ++i )
+            vec.emplace_back( "short" );
+        ASSERT_EQ( vec.size(), 8 );
+        ASSERT_EQ( vec.get_allocator().resource(), &scope );
+    }
+    // Each vector released the last allocation, so the arena reused the same bytes.
+    EXPECT_EQ( upstream.allocations, 1 );
+
+    scope.release();
+    EXPECT_EQ( scope.bytes_allocated(), 0 );
+    EXPECT_EQ( upstream.deallocations, 1 );
+}
+
+TEST(Arena, InitialBuffer)
+{
+    alignas(std::max_align_t) char buffer[512];
+    CountingResource upstream;
+    sc::arena scope( buffer, sizeof(buffer), &upstream );
+
+    sc::pmr::vector<int> vec( 16, &scope );
+    for ( auto i{0} ; i < 16 ; ++i )
+        vec.push_back( i );
+
+    auto p = reinterpret_cast<char*>( vec.data() );
+    EXPECT_TRUE( p >= buffer and p < buffer + sizeof(buffer) );
+    EXPECT_EQ( upstream.allocations, 0 );
+}
+
+TEST(Arena, CopyAndMoveAcrossResources)
+{
+    sc::arena first, second;
+    sc::pmr::vector<int> vec( { 1, 2, 3, 4, 5 }, &first );
+
+    // Copy into another arena.
+    sc::pmr::vector<int> copy( vec, &second );
+    ASSERT_EQ( copy, vec );
+    EXPECT_EQ( copy.get_allocator().resource(), &second );
+
+    // Moving between different resources moves the elements.
+    sc::pmr::vector<int> moved( &second );
+    moved = std::move( vec );
+    ASSERT_EQ( moved, copy );
+    EXPECT_EQ( moved.get_allocator().resource(), &second );
+
+    // Moving within the same resource steals the buffer.
+    auto data = moved.data();
+    sc::pmr::vector<int> stolen( std::move( moved ), &second );
+    EXPECT_EQ( stolen.data(), data );
+}
+
+// polymorphic_allocator that follows move assignment, to check that the allocator-extended
+// move constructor keeps the allocator it was given.
+template < typename T >
+struct propagating_allocator : std::pmr::polymorphic_allocator<T>
+{
+    using propagate_on_container_move_assignment = std::true_type;
+
+    propagating_allocator( std::pmr::memory_resource * resource ) : std::pmr::polymorphic_allocator<T>( resource ) { }
+    template < typename U >
+    propagating_allocator( const propagating_allocator<U> & other ) : std::pmr::polymorphic_allocator<T>( other.resource() ) { }
+};
+
+TEST(Arena, MoveConstructorKeepsGivenAllocator)
+{
+    using propagating_vector = sc::vector<int, propagating_allocator<int>>;
+    sc::arena first, second;
+    propagating_vector vec( { 1, 2, 3 }, &first );
+
+    propagating_vector moved( std::move( vec ), &second );
+    EXPECT_EQ( moved.get_allocator().resource(), &second );
+    ASSERT_EQ( moved, ( propagating_vector( { 1, 2, 3 }, &second ) ) );
+    EXPECT_TRUE( vec.empty() );
+    EXPECT_EQ( vec.get_allocator().resource(), &first );
+
+    // Same resource: the block is taken.
+    auto data = moved.data();
+    propagating_vector stolen( std::move( moved ), &second );
+    EXPECT_EQ( stolen.data(), data );
+    EXPECT_EQ( stolen.get_allocator().resource(), &second );
+}
+
+TEST(Arena, DevectorAssignmentAcrossResources)
+{
+    // polymorphic_allocator does not propagate: each devector keeps its resource and frees only its own blocks.
+    using pmr_devector = sc::devector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+    CountingResource first, second;
+    {
+        pmr_devector vec( { "a", "b", "c" }, &first );
+        pmr_devector other( &second );
+        other.push_front( "z" );
+
+        other = vec;
+        ASSERT_EQ( other, vec );
+        EXPECT_EQ( other.get_allocator().resource(), &second );
+
+        pmr_devector moved( &second );
+        moved = std::move( vec );
+        ASSERT_EQ( moved, other );
+        EXPECT_TRUE( vec.empty() );
+        EXPECT_EQ( moved.get_allocator().resource(), &second );
+        EXPECT_EQ( vec.get_allocator().resource(), &first );
+
+        // Same resource: the block is taken, not copied.
+        auto data = moved.data();
+        other = std::move( moved );
+        EXPECT_EQ( other.data(), data );
+        ASSERT_EQ( other.size(), 3 );
+        ASSERT_EQ( other.back(), "c" );
+    }
+    EXPECT_EQ( first.deallocations, first.allocations );
+    EXPECT_EQ( second.deallocations, second.allocations );
+}
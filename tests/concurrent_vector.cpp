@@ -0,0 +1,183 @@
+#include <atomic>               // std::atomic
+#include <memory>               // std::unique_ptr
+#include <new>                  // std::bad_alloc
+#include <stdexcept>            // std::out_of_range, std::runtime_error
+#include <string>               // std::string
+#include <thread>               // std::thread
+#include <vector>               // std::vector
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/concurrent_vector.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING CONCURRENT_VECTOR
+// ============================================================================
+
+TEST(ConcurrentVector, SingleThread)
+{
+    sc::concurrent_vector<int, std::allocator<int>, 4> vec;
+    ASSERT_TRUE( vec.empty() );
+
+    // Atravessa vários segmentos (4, 8, 16, ...).
+    for ( auto i{0} ; i < 1000 ; ++i )
+        ASSERT_EQ( vec.push_back( i ), static_cast<unsigned long>( i ) );
+    ASSERT_EQ( vec.size(), 1000u );
+    ASSERT_GE( vec.capacity(), 1000u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], i );
+
+    ASSERT_EQ( vec.at( 999 ), 999 );
+    ASSERT_THROW( vec.at( 1000 ), std::out_of_range );
+    ASSERT_FALSE( vec.is_published( 1000 ) );
+
+    sc::vector<int> flat = vec.to_vector();
+    ASSERT_EQ( flat.size(), 1000u );
+    for ( auto i{0u} ; i < flat.size() ; ++i )
+        ASSERT_EQ( flat[i], i );
+
+    vec.clear();
+    ASSERT_TRUE( vec.empty() );
+    ASSERT_EQ( vec.capacity(), 0u );
+}
+
+TEST(ConcurrentVector, ElementsNeverMove)
+{
+    sc::concurrent_vector<std::string> vec;
+    vec.push_back( "first" );
+    const std::string * address = &vec[0];
+    for ( auto i{0} ; i < 10000 ; ++i )
+        vec.emplace_back( 40, 'x' );
+    ASSERT_EQ( &vec[0], address );
+    ASSERT_EQ( vec[0], "first" );
+
+    sc::concurrent_vector<std::string> copy( vec );
+    ASSERT_EQ( copy.size(), vec.size() );
+    ASSERT_EQ( copy[10000], std::string( 40, 'x' ) );
+}
+
+TEST(ConcurrentVector, ThrowingConstructorLeavesAHole)
+{
+    struct Picky {
+        int value;
+        explicit Picky( int v ) : value( v ) { if ( v < 0 ) throw std::runtime_error( "negative" ); }
+    };
+    sc::concurrent_vector<Picky> vec;
+    vec.emplace_back( 1 );
+    ASSERT_THROW( vec.emplace_back( -1 ), std::runtime_error );
+    vec.emplace_back( 3 );
+
+    ASSERT_EQ( vec.size(), 3u );
+    ASSERT_FALSE( vec.is_published( 1 ) );
+    auto flat = vec.to_vector();
+    ASSERT_EQ( flat.size(), 2u );
+    ASSERT_EQ( flat[1].value, 3 );
+}
+
+// Allocator that fails once a budget of segments is spent, and counts the blocks still held.
+template < typename T >
+struct LimitedAllocator {
+    using value_type = T;
+    static inline int budget = 0;
+    static inline int outstanding = 0;
+
+    LimitedAllocator( void ) = default;
+    template < typename U > LimitedAllocator( const LimitedAllocator<U> & ) { }
+
+    T * allocate( std::size_t n )
+    {
+        if ( budget == 0 )
+            throw std::bad_alloc();
+        --budget;
+        ++outstanding;
+        return std::allocator<T>().allocate( n );
+    }
+    void deallocate( T * p, std::size_t n )
+    {
+        --outstanding;
+        std::allocator<T>().deallocate( p, n );
+    }
+    template < typename U > bool operator==( const LimitedAllocator<U> & ) const { return true; }
+    template < typename U > bool operator!=( const LimitedAllocator<U> & ) const { return false; }
+};
+
+TEST(ConcurrentVector, FailedSegmentAllocationLeaksNothing)
+{
+    LimitedAllocator<int>::budget = 1;
+    {
+        sc::concurrent_vector<int, LimitedAllocator<int>, 4> vec;
+        for ( auto i{0} ; i < 4 ; ++i )
+            vec.push_back( i );
+        // The second segment cannot be allocated: the index is lost, nothing else is.
+        ASSERT_THROW( vec.push_back( 4 ), std::bad_alloc );
+        ASSERT_EQ( LimitedAllocator<int>::outstanding, 1 );
+
+        LimitedAllocator<int>::budget = 1;
+        vec.push_back( 5 );
+        ASSERT_FALSE( vec.is_published( 4 ) );
+        ASSERT_EQ( vec[5], 5 );
+    }
+    ASSERT_EQ( LimitedAllocator<int>::outstanding, 0 );
+}
+
+TEST(ConcurrentVector, StressManyProducers)
+{
+    constexpr int producers = 8;
+    constexpr int per_thread = 50000;
+    constexpr int total = producers * per_thread;
+
+    sc::concurrent_vector<long> vec;
+    // where[v] = índice + 1 do valor v, publicado pelo produtor com release.
+    std::unique_ptr<std::atomic<unsigned long>[]> where( new std::atomic<unsigned long>[total]() );
+    std::atomic<bool> done{false};
+
+    // Um leitor confere, enquanto os produtores inserem, os elementos já publicados.
+    std::thread reader( [&] {
+        while ( not done.load() )
+        {
+            for ( int v = 0 ; v < total ; v += 997 )
+            {
+                unsigned long idx = where[v].load( std::memory_order_acquire );
+                if ( idx != 0 )
+                {
+                    EXPECT_EQ( vec[idx - 1], v );
+                }
+            }
+        }
+    } );
+
+    std::vector<std::thread> threads;
+    for ( int t = 0 ; t < producers ; ++t )
+    {
+        threads.emplace_back( [&, t] {
+            for ( int j = 0 ; j < per_thread ; ++j )
+            {
+                long v = static_cast<long>( t ) * per_thread + j;
+                auto idx = vec.push_back( v );
+                where[v].store( idx + 1, std::memory_order_release );
+            }
+        } );
+    }
+    for ( auto & t : threads )
+        t.join();
+    done = true;
+    reader.join();
+
+    ASSERT_EQ( vec.size(), static_cast<unsigned long>( total ) );
+
+    // Cada valor aparece exatamente uma vez, no índice devolvido a quem o inseriu.
+    std::vector<bool> seen( total, false );
+    for ( unsigned long i = 0 ; i < vec.size() ; ++i )
+    {
+        ASSERT_TRUE( vec.is_published( i ) );
+        long v = vec[i];
+        ASSERT_FALSE( seen[v] );
+        seen[v] = true;
+        ASSERT_EQ( where[v].load(), i + 1 );
+    }
+
+    auto flat = vec.to_vector();
+    ASSERT_EQ( flat.size(), vec.size() );
+    for ( unsigned long i = 0 ; i < flat.size() ; ++i )
+        ASSERT_EQ( flat[i], vec[i] );
+}
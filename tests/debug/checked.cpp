@@ -0,0 +1,161 @@
+#include <stdexcept>            // std::runtime_error
+#include <string>               // std::string
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../../include/vector.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING THE CHECKED MODE (built only into ex_debug, with SC_VECTOR_DEBUG)
+// ============================================================================
+
+#ifndef SC_VECTOR_DEBUG
+#error "tests/debug must be compiled with SC_VECTOR_DEBUG"
+#endif
+
+TEST(CheckedVector, IteratorSurvivesGrowthWithinCapacity)
+{
+    sc::vector<int> vec;
+    vec.reserve( 10 );
+    vec.push_back( 1 );
+    auto it = vec.begin();
+    for ( auto i{0} ; i < 9 ; ++i )
+        vec.push_back( i );
+    EXPECT_EQ( *it, 1 );
+
+    // Returned iterators are always fresh.
+    auto next = vec.erase( it );
+    EXPECT_EQ( *next, 0 );
+    auto inserted = vec.insert( vec.cbegin(), 7 );
+    EXPECT_EQ( *inserted, 7 );
+}
+
+TEST(CheckedVector, IteratorSurvivesMoveAndSwap)
+{
+    // The block moves with its iterators: they now belong to the vector that took it.
+    sc::vector<int> a{ 1, 2, 3 };
+    auto it = a.begin() + 1;
+    sc::vector<int> b( std::move( a ) );
+    EXPECT_EQ( *it, 2 );
+    it = b.erase( it );
+    EXPECT_EQ( *it, 3 );
+
+    sc::vector<int> c{ 4, 5 };
+    c = std::move( b );
+    auto from_b = c.cbegin();
+    EXPECT_EQ( *from_b, 1 );
+
+    sc::vector<int> d{ 6, 7 };
+    auto from_d = d.begin();
+    d.swap( c );
+    EXPECT_EQ( *from_d, 6 );
+    EXPECT_EQ( *from_b, 1 );
+    c.insert( from_d + 1, 8 );
+    d.insert( from_b, 0 );
+    EXPECT_EQ( c, ( sc::vector<int>{ 6, 8, 7 } ) );
+    EXPECT_EQ( d, ( sc::vector<int>{ 0, 1, 3 } ) );
+
+    // The moved-from vector starts over with a fresh state.
+    a.push_back( 9 );
+    a.erase( a.begin() );
+    EXPECT_TRUE( a.empty() );
+}
+
+// Copying throws while fail is set.
+struct FragileCopy
+{
+    static inline bool fail = false;
+    int value;
+
+    FragileCopy( int v ) : value( v ) { }
+    FragileCopy( const FragileCopy & other ) : value( other.value )
+    {
+        if ( fail )
+            throw std::runtime_error( "copy" );
+    }
+    FragileCopy( FragileCopy && ) noexcept = default;
+    FragileCopy & operator=( const FragileCopy & ) = default;
+};
+
+TEST(CheckedVector, IteratorSurvivesFailedGrowth)
+{
+    // The old block is kept when the copy into a new one throws, and so are its iterators.
+    sc::vector<FragileCopy> vec;
+    vec.push_back( FragileCopy( 1 ) );
+    auto it = vec.begin();
+    FragileCopy extra( 2 );
+
+    FragileCopy::fail = true;
+    ASSERT_THROW( vec.push_back( extra ), std::runtime_error );
+    ASSERT_THROW( vec.assign( 10, extra ), std::runtime_error );
+    FragileCopy::fail = false;
+
+    ASSERT_EQ( vec.size(), 1u );
+    EXPECT_EQ( it->value, 1 );
+    vec.erase( it );
+    EXPECT_TRUE( vec.empty() );
+}
+
+TEST(CheckedVectorDeathTest, IteratorIntoBlockReplacedByMoveAssignment)
+{
+    sc::vector<int> a{ 1, 2 };
+    sc::vector<int> b{ 4, 5 };
+    auto it = b.cbegin();
+    b = std::move( a );
+    EXPECT_DEATH( (void) *it, "reallocated" );
+}
+
+TEST(CheckedVectorDeathTest, IteratorAfterReallocation)
+{
+    sc::vector<int> vec{ 1, 2, 3 };
+    auto it = vec.begin();
+    vec.reserve( 100 );
+    EXPECT_DEATH( (void) *it, "reallocated" );
+}
+
+TEST(CheckedVectorDeathTest, IteratorAfterPushBackGrowth)
+{
+    sc::vector<std::string> vec{ "a" };
+    auto it = vec.cbegin();
+    vec.push_back( "b" );
+    EXPECT_DEATH( (void) it->size(), "reallocated" );
+}
+
+TEST(CheckedVectorDeathTest, IteratorAfterClearAndDestruction)
+{
+    sc::vector<int> vec{ 1, 2, 3 };
+    auto it = vec.begin() + 1;
+    vec.clear();
+    EXPECT_DEATH( (void) it[0], "cleared" );
+
+    sc::vector<int>::iterator dangling;
+    {
+        sc::vector<int> local{ 4, 5 };
+        dangling = local.begin();
+    }
+    EXPECT_DEATH( (void) *dangling, "destroyed" );
+}
+
+TEST(CheckedVectorDeathTest, ForeignOrStaleIteratorPassedToVector)
+{
+    sc::vector<int> a{ 1, 2, 3 };
+    sc::vector<int> b{ 4, 5, 6 };
+    EXPECT_DEATH( a.erase( b.begin() ), "does not belong" );
+
+    auto stale = a.cbegin();
+    a.shrink_to_fit();
+    a.push_back( 4 );
+    EXPECT_DEATH( a.insert( stale, 0 ), "reallocated" );
+}
+
+TEST(CheckedVectorDeathTest, BoundsChecks)
+{
+    sc::vector<int> vec{ 1, 2, 3 };
+    EXPECT_DEATH( (void) vec[3], "out of range" );
+
+    sc::vector<int> empty;
+    EXPECT_DEATH( (void) empty.front(), "empty" );
+    EXPECT_DEATH( (void) empty.back(), "empty" );
+    EXPECT_DEATH( empty.pop_back(), "empty" );
+    EXPECT_DEATH( empty.pop_front(), "empty" );
+}
@@ -0,0 +1,211 @@
+#include <algorithm>            // std::lower_bound, std::equal, std::is_sorted
+#include <functional>           // std::less, std::greater
+#include <iterator>             // std::istream_iterator
+#include <map>                  // std::map
+#include <random>               // std::mt19937
+#include <set>                  // std::set
+#include <sstream>              // std::istringstream
+#include <stdexcept>            // std::out_of_range, std::runtime_error
+#include <string>               // std::string
+#include <utility>              // std::pair
+#include <vector>               // std::vector
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/flat_map.h"     // header file for tested functions
+
+
+// ============================================================================
+// TESTING FLAT_SET
+// ============================================================================
+
+TEST(FlatSet, BranchlessLowerBoundMatchesStd)
+{
+    std::less<int> comp;
+    for ( int n{0} ; n < 40 ; ++n )
+    {
+        std::vector<int> keys;
+        for ( int i{0} ; i < n ; ++i )
+            keys.push_back( 2 * i );
+        for ( int key{-1} ; key <= 2 * n ; ++key )
+            ASSERT_EQ( sc::detail::branchless_lower_bound( keys.data(), keys.size(), key, comp ),
+                       std::size_t( std::lower_bound( keys.begin(), keys.end(), key ) - keys.begin() ) );
+    }
+}
+
+TEST(FlatSet, InsertFindErase)
+{
+    sc::flat_set<int> set;
+    ASSERT_TRUE( set.empty() );
+    ASSERT_EQ( set.find( 3 ), set.end() );
+
+    ASSERT_TRUE( set.insert( 5 ).second );
+    ASSERT_TRUE( set.insert( 1 ).second );
+    ASSERT_TRUE( set.insert( 3 ).second );
+    auto [it, inserted] = set.insert( 3 );
+    ASSERT_FALSE( inserted );
+    ASSERT_EQ( *it, 3 );
+    ASSERT_EQ( set.size(), 3u );
+
+    ASSERT_TRUE( set.contains( 1 ) );
+    ASSERT_FALSE( set.contains( 2 ) );
+    ASSERT_EQ( *set.lower_bound( 2 ), 3 );
+    ASSERT_EQ( *set.upper_bound( 3 ), 5 );
+    ASSERT_EQ( set.upper_bound( 5 ), set.end() );
+
+    ASSERT_EQ( set.erase( 3 ), 1u );
+    ASSERT_EQ( set.erase( 3 ), 0u );
+    ASSERT_EQ( set, ( sc::flat_set<int>{ 1, 5 } ) );
+}
+
+TEST(FlatSet, BatchInsertMatchesStdSet)
+{
+    std::mt19937 gen( 7 );
+    std::uniform_int_distribution<int> dist( 0, 500 );
+    sc::flat_set<int> set{ 10, 20, 30 };
+    std::set<int> expected{ 10, 20, 30 };
+
+    for ( int round{0} ; round < 5 ; ++round )
+    {
+        std::vector<int> batch;
+        for ( int i{0} ; i < 200 ; ++i )
+            batch.push_back( dist( gen ) );
+        set.insert( batch.begin(), batch.end() );
+        expected.insert( batch.begin(), batch.end() );
+        ASSERT_EQ( set.size(), expected.size() );
+        ASSERT_TRUE( std::equal( set.begin(), set.end(), expected.begin() ) );
+    }
+    ASSERT_EQ( set.keys().data(), &*set.begin() );
+}
+
+TEST(FlatSet, SinglePassRange)
+{
+    std::istringstream in( "3 1 2 1" );
+    sc::flat_set<int> set{ std::istream_iterator<int>( in ), std::istream_iterator<int>() };
+    ASSERT_EQ( set.size(), 3 );
+    ASSERT_EQ( set, ( sc::flat_set<int>{ 1, 2, 3 } ) );
+
+    std::istringstream more( "5 0 2" );
+    set.insert( std::istream_iterator<int>( more ), std::istream_iterator<int>() );
+    ASSERT_EQ( set, ( sc::flat_set<int>{ 0, 1, 2, 3, 5 } ) );
+}
+
+TEST(FlatSet, CustomOrder)
+{
+    sc::flat_set<std::string, std::greater<std::string> > set{ "b", "a", "c", "a" };
+    ASSERT_EQ( set.size(), 3u );
+    ASSERT_EQ( *set.begin(), "c" );
+    ASSERT_EQ( *set.find( "a" ), "a" );
+}
+
+// Less-than that throws once its budget of comparisons is spent (negative: never).
+struct BudgetLess
+{
+    static inline int budget = -1;
+
+    bool operator()( int a, int b ) const
+    {
+        if ( budget == 0 )
+            throw std::runtime_error( "compare" );
+        if ( budget > 0 )
+            --budget;
+        return a < b;
+    }
+};
+
+TEST(FlatSet, FailedBatchInsertLeavesSetUnchanged)
+{
+    sc::flat_set<int, BudgetLess> set{ 10, 20, 30, 40, 50 };
+    std::vector<int> more{ 45, 5, 35, 25, 15, 55, 20 };
+
+    // Throw at different points of the sort and merge.
+    for ( int budget : { 3, 12 } )
+    {
+        BudgetLess::budget = budget;
+        ASSERT_THROW( set.insert( more.begin(), more.end() ), std::runtime_error );
+        BudgetLess::budget = -1;
+        ASSERT_EQ( set, ( sc::flat_set<int, BudgetLess>{ 10, 20, 30, 40, 50 } ) );
+        ASSERT_TRUE( set.contains( 40 ) );
+        ASSERT_FALSE( set.contains( 45 ) );
+    }
+
+    set.insert( more.begin(), more.end() );
+    ASSERT_EQ( set.size(), 11u );
+    ASSERT_TRUE( std::is_sorted( set.begin(), set.end() ) );
+}
+
+
+// ============================================================================
+// TESTING FLAT_MAP
+// ============================================================================
+
+TEST(FlatMap, InsertFindErase)
+{
+    sc::flat_map<int, std::string> map;
+    ASSERT_TRUE( map.insert( { 2, "two" } ).second );
+    ASSERT_TRUE( map.try_emplace( 1, "one" ).second );
+    ASSERT_FALSE( map.try_emplace( 1, "uno" ).second );
+    ASSERT_FALSE( map.insert_or_assign( 2, "dois" ).second );
+    map[3] = "three";
+
+    ASSERT_EQ( map.size(), 3u );
+    ASSERT_EQ( map.at( 1 ), "one" );
+    ASSERT_EQ( map.at( 2 ), "dois" );
+    ASSERT_THROW( map.at( 4 ), std::out_of_range );
+    ASSERT_EQ( map.find( 3 )->second, "three" );
+    ASSERT_EQ( map.find( 4 ), map.end() );
+
+    // Keys and values live in separate arrays, in key order.
+    ASSERT_EQ( map.keys()[0], 1 );
+    ASSERT_EQ( map.values()[2], "three" );
+
+    map.find( 3 )->second = "tres";
+    ASSERT_EQ( map[3], "tres" );
+
+    ASSERT_EQ( map.erase( 2 ), 1u );
+    ASSERT_EQ( map.erase( 2 ), 0u );
+    auto next = map.erase( map.begin() );
+    ASSERT_EQ( next->first, 3 );
+    ASSERT_EQ( map.size(), 1u );
+}
+
+TEST(FlatMap, Iteration)
+{
+    const sc::flat_map<std::string, int> map{ { "c", 3 }, { "a", 1 }, { "b", 2 } };
+    std::string keys;
+    int sum{0};
+    for ( auto [key, value] : map )
+    {
+        keys += key;
+        sum += value;
+    }
+    ASSERT_EQ( keys, "abc" );
+    ASSERT_EQ( sum, 6 );
+    ASSERT_EQ( map.end() - map.begin(), 3 );
+    ASSERT_EQ( ( map.begin() + 2 )->first, "c" );
+}
+
+TEST(FlatMap, BatchInsertMatchesStdMap)
+{
+    std::mt19937 gen( 11 );
+    std::uniform_int_distribution<int> dist( 0, 300 );
+    sc::flat_map<int, int> map{ { 5, -5 } };
+    std::map<int, int> expected{ { 5, -5 } };
+
+    for ( int round{0} ; round < 5 ; ++round )
+    {
+        std::vector<std::pair<int, int> > batch;
+        for ( int i{0} ; i < 150 ; ++i )
+            batch.emplace_back( dist( gen ), round * 1000 + i );
+        map.insert( batch.begin(), batch.end() );
+        // std::map::insert keeps the existing value and the first of repeated keys, as flat_map does.
+        expected.insert( batch.begin(), batch.end() );
+        ASSERT_EQ( map.size(), expected.size() );
+        auto it = expected.begin();
+        for ( auto [key, value] : map )
+        {
+            ASSERT_EQ( key, it->first );
+            ASSERT_EQ( value, it->second );
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <algorithm>            // std::sort, std::lower_bound, std::reverse
+#include <cstddef>              // std::ptrdiff_t
+#include <iterator>             // std::distance, std::iterator_traits
+#include <type_traits>          // std::is_same, std::void_t
+#include <utility>              // std::declval
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/vector.h"  // header file for tested functions
+
+
+// ============================================================================
+// TESTING THE ITERATOR AS A RANDOM ACCESS (CONTIGUOUS) ITERATOR
+// ============================================================================
+
+using iter = sc::vector<int>::iterator;
+using citer = sc::vector<int>::const_iterator;
+
+static_assert( std::is_same< std::iterator_traits<iter>::iterator_category, std::random_access_iterator_tag >::value,
+               "MyIterator must be a random access iterator" );
+static_assert( std::is_same< std::iterator_traits<citer>::value_type, int >::value,
+               "value_type of a const iterator drops the const" );
+static_assert( std::is_convertible< iter, citer >::value, "iterator converts to const_iterator" );
+static_assert( not std::is_convertible< citer, iter >::value, "const_iterator does not convert to iterator" );
+
+// n - it is not an iterator operation: it must not compile.
+template < typename It, typename = void >
+struct has_number_minus_iterator : std::false_type { };
+template < typename It >
+struct has_number_minus_iterator< It, std::void_t< decltype( std::ptrdiff_t( 2 ) - std::declval<It>() ) > > : std::true_type { };
+static_assert( not has_number_minus_iterator<iter>::value and not has_number_minus_iterator<citer>::value,
+               "n - iterator must not compile" );
+#if __cplusplus > 201703L
+static_assert( std::contiguous_iterator<iter> and std::contiguous_iterator<citer> );
+#endif
+
+TEST(Iterator, Arithmetic)
+{
+    sc::vector<int> vec { 1, 2, 3, 4, 5 };
+
+    auto it = vec.begin();
+    it += 3;
+    ASSERT_EQ( *it, 4 );
+    it -= 2;
+    ASSERT_EQ( *it, 2 );
+    ASSERT_EQ( it[2], 4 );
+    ASSERT_EQ( vec.end() - vec.begin(), 5 );
+    ASSERT_EQ( std::distance( vec.begin(), vec.end() ), 5 );
+    ASSERT_EQ( vec.begin() + 5, vec.end() );
+}
+
+TEST(Iterator, Comparison)
+{
+    sc::vector<int> vec { 1, 2, 3 };
+
+    ASSERT_TRUE( vec.begin() < vec.end() );
+    ASSERT_TRUE( vec.end() > vec.begin() );
+    ASSERT_TRUE( vec.begin() <= vec.begin() );
+    ASSERT_TRUE( vec.end() >= vec.begin() + 3 );
+    ASSERT_FALSE( vec.begin() + 1 < vec.begin() + 1 );
+
+    // iterator e const_iterator se comparam entre si.
+    citer c = vec.begin();
+    ASSERT_TRUE( c == vec.cbegin() );
+    ASSERT_TRUE( c < vec.cend() );
+}
+
+TEST(Iterator, StandardAlgorithms)
+{
+    sc::vector<int> vec { 5, 3, 9, 1, 7, 2 };
+
+    std::sort( vec.begin(), vec.end() );
+    ASSERT_EQ( vec, sc::vector<int>( { 1, 2, 3, 5, 7, 9 } ) );
+
+    const sc::vector<int> & cvec = vec;
+    auto it = std::lower_bound( cvec.begin(), cvec.end(), 5 );
+    ASSERT_EQ( it - cvec.begin(), 3 );
+
+    std::reverse( vec.begin(), vec.end() );
+    ASSERT_EQ( vec, sc::vector<int>( { 9, 7, 5, 3, 2, 1 } ) );
+}
+
+TEST(Iterator, ConstIteratorPositions)
+{
+    sc::vector<int> vec { 1, 2, 3 };
+
+    // insert/erase aceitam const_iterator.
+    vec.insert( vec.cbegin() + 1, 10 );
+    ASSERT_EQ( vec, sc::vector<int>( { 1, 10, 2, 3 } ) );
+    vec.erase( vec.cbegin(), vec.cbegin() + 2 );
+    ASSERT_EQ( vec, sc::vector<int>( { 2, 3 } ) );
+}
@@ -1,39 +1,74 @@
 #include <iterator>             // std::begin(), std::end()
 #include <functional>           // std::function
-#include <algorithm>            // std::min_element
+#include <sstream>              // std::istringstream
+#include <algorithm>            // std::min_element, std::max
+#include <string>               // std::string
+#include <type_traits>          // std::is_same
+#include <utility>              // std::pair
+#include <vector>               // std::vector
 
 #include "gtest/gtest.h"        // gtest lib
 #include "../include/vector.h"   // header file for tested functions
+#include "../include/devector.h" // header file for tested functions
+#include "../include/small_vector.h" // header file for tested functions
 
 
 
 // ============================================================================
 // TESTING VECTOR AS A CONTAINER OF INTEGERS
 // ============================================================================
+// The container tests run against sc::vector and against sc::small_vector
+// with an inline capacity smaller than the vectors used below (mostly on the
+// heap) and one larger (entirely inline). The tests of growth and trimming
+// rules are specific to sc::vector.
 
-TEST(IntVector, DefaultConstructor)
+template < typename V >
+class IntVector : public ::testing::Test { };
+
+using IntVectorTypes = ::testing::Types< sc::vector<int>, sc::small_vector<int, 2>, sc::small_vector<int, 16> >;
+TYPED_TEST_SUITE( IntVector, IntVectorTypes );
+
+// The container under test, holding U instead of int.
+template < typename V, typename U > struct rebind_vector;
+template < typename T, typename U > struct rebind_vector< sc::vector<T>, U > { using type = sc::vector<U>; };
+template < typename T, std::size_t N, typename U > struct rebind_vector< sc::small_vector<T, N>, U > { using type = sc::small_vector<U, N>; };
+
+template < typename V, typename U >
+using vector_of = typename rebind_vector< V, U >::type;
+
+// Capacity of a freshly built container asked for n elements: small_vector never goes below its buffer.
+template < typename V >
+std::size_t capacity_for( std::size_t n )
 {
-    sc::vector<int> vec;
+    if constexpr ( std::is_same< V, sc::vector<typename V::value_type> >::value )
+        return n;
+    else
+        return std::max<std::size_t>( n, V::inline_capacity );
+}
+
+TYPED_TEST(IntVector, DefaultConstructor)
+{
+    TypeParam vec;
 
     EXPECT_EQ( vec.size(), 0 );
-    EXPECT_EQ( vec.capacity(), 0 );
+    EXPECT_EQ( vec.capacity(), capacity_for<TypeParam>( 0 ) );
     EXPECT_TRUE( vec.empty() );
 }
 
 
-TEST(IntVector, ConstructorSize)
+TYPED_TEST(IntVector, ConstructorSize)
 {
-    sc::vector<int> vec(10);
+    TypeParam vec(10);
 
     EXPECT_EQ( vec.size(), 0 );
-    EXPECT_EQ( vec.capacity(), 10 );
+    EXPECT_EQ( vec.capacity(), capacity_for<TypeParam>( 10 ) );
     EXPECT_TRUE( vec.empty() );
 }
 
 
-TEST(IntVector, ListConstructor)
+TYPED_TEST(IntVector, ListConstructor)
 {
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec{ 1, 2, 3, 4, 5 };
     ASSERT_EQ( vec.size(), 5 );
     EXPECT_FALSE( vec.empty() );
 
@@ -41,11 +76,11 @@ TEST(IntVector, ListConstructor)
         ASSERT_EQ( i+1, vec[i] );
 }
 
-TEST(IntVector, RangeConstructor)
+TYPED_TEST(IntVector, RangeConstructor)
 {
     // Range = the entire vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2( vec.begin(), vec.end() );
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec2( vec.begin(), vec.end() );
     ASSERT_EQ( vec2.size(), 5 );
     EXPECT_FALSE( vec.empty() );
 
@@ -53,7 +88,7 @@ TEST(IntVector, RangeConstructor)
         ASSERT_EQ( i+1, vec[i] );
 
     // Range is part of the vector.
-    sc::vector<int> vec3( std::next( vec.begin(), 1 ), std::next( vec.begin(), 3 ) );
+    TypeParam vec3( std::next( vec.begin(), 1 ), std::next( vec.begin(), 3 ) );
     ASSERT_EQ( vec3.size(), 2 );
     EXPECT_FALSE( vec3.empty() );
 
@@ -61,13 +96,31 @@ TEST(IntVector, RangeConstructor)
         ASSERT_EQ( vec[i+1], vec3[i] );
 }
 
-TEST(IntVector, CopyConstructor)
+TEST(IntVector, RangeConstructorInputIterator)
+{
+    // A single-pass range can only be read once: it must not be measured before being copied.
+    std::istringstream words( "a b c d" );
+    sc::vector<std::string> vec{ std::istream_iterator<std::string>( words ), std::istream_iterator<std::string>() };
+    ASSERT_EQ( vec.size(), 4 );
+    ASSERT_EQ( vec, ( sc::vector<std::string>{ "a", "b", "c", "d" } ) );
+
+    std::istringstream numbers( "1 2 3 4 5" );
+    sc::vector<int> ints{ std::istream_iterator<int>( numbers ), std::istream_iterator<int>() };
+    ASSERT_EQ( ints, ( sc::vector<int>{ 1, 2, 3, 4, 5 } ) );
+
+    std::istringstream empty( "" );
+    sc::vector<int> none{ std::istream_iterator<int>( empty ), std::istream_iterator<int>() };
+    ASSERT_TRUE( none.empty() );
+}
+
+TYPED_TEST(IntVector, CopyConstructor)
 {
     // Range = the entire vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2( vec );
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec2( vec );
     ASSERT_EQ( vec2.size(), 5 );
     EXPECT_FALSE( vec2.empty() );
+    EXPECT_NE( vec2.data(), vec.data() );
 
     // CHeck whether the copy worked.
     for( auto i{0u} ; i < vec2.size() ; ++i )
@@ -80,24 +133,29 @@ TEST(IntVector, CopyConstructor)
         ASSERT_EQ( i+1, vec2[i] );
 }
 
-TEST(IntVector, MoveConstructor)
+TYPED_TEST(IntVector, MoveConstructor)
 {
     // Range = the entire vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2( std::move( vec ) );
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec2( std::move( vec ) );
     ASSERT_EQ( vec2.size(), 5 );
     EXPECT_FALSE( vec2.empty() );
+    EXPECT_TRUE( vec.empty() );
 
     // CHeck whether the copy worked.
     for( auto i{0u} ; i < vec2.size() ; ++i )
         ASSERT_EQ( i+1, vec2[i] );
+
+    // The moved-from vector is still usable.
+    vec.push_back( 42 );
+    ASSERT_EQ( vec.back(), 42 );
 }
 
-TEST(IntVector, AssignOperator)
+TYPED_TEST(IntVector, AssignOperator)
 {
     // Range = the entire vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2;
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec2;
 
     vec2 = vec;
     ASSERT_EQ( vec2.size(), 5 );
@@ -108,17 +166,17 @@ TEST(IntVector, AssignOperator)
         ASSERT_EQ( i+1, vec2[i] );
 }
 
-TEST(IntVector, MoveAssignOperator)
+TYPED_TEST(IntVector, MoveAssignOperator)
 {
     // Range = the entire vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2;
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec2;
 
     vec2 = std::move( vec );
     ASSERT_EQ( vec2.size(), 5 );
     ASSERT_FALSE( vec2.empty() );
     EXPECT_EQ( vec.size(), 0 );
-    EXPECT_EQ( vec.capacity(), 0 );
+    EXPECT_LE( vec.capacity(), capacity_for<TypeParam>( 0 ) );
     EXPECT_TRUE( vec.empty() );
 
     // CHeck whether the copy worked.
@@ -126,13 +184,13 @@ TEST(IntVector, MoveAssignOperator)
         ASSERT_EQ( i+1, vec2[i] );
 }
 
-TEST(IntVector, ListInitializerAssign)
+TYPED_TEST(IntVector, ListInitializerAssign)
 {
     // Range = the entire vector.
-    sc::vector<int> vec = { 1, 2, 3, 4, 5 };
+    TypeParam vec = { 1, 2, 3, 4, 5 };
 
     EXPECT_EQ( vec.size(), 5 );
-    EXPECT_EQ( vec.capacity(), 5 );
+    EXPECT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     EXPECT_FALSE( vec.empty() );
 
     // CHeck whether the copy worked.
@@ -140,26 +198,26 @@ TEST(IntVector, ListInitializerAssign)
         ASSERT_EQ( i+1, vec[i] );
 }
 
-TEST(IntVector, Clear)
+TYPED_TEST(IntVector, Clear)
 {
     // Range = the entire vector.
-    sc::vector<int> vec = { 1, 2, 3, 4, 5 };
+    TypeParam vec = { 1, 2, 3, 4, 5 };
 
     EXPECT_EQ( vec.size(), 5 );
-    EXPECT_EQ( vec.capacity(), 5 );
+    EXPECT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     EXPECT_FALSE( vec.empty() );
 
     vec.clear();
 
     EXPECT_EQ( vec.size(), 0 );
-    EXPECT_EQ( vec.capacity(), 5 );
+    EXPECT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     EXPECT_TRUE( vec.empty() );
 }
 
-TEST(IntVector, PushFront)
+TYPED_TEST(IntVector, PushFront)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec;
+    TypeParam vec;
 
     ASSERT_TRUE( vec.empty() );
     for ( auto i{0} ; i < 5 ; ++i )
@@ -186,10 +244,10 @@ TEST(IntVector, PushFront)
         ASSERT_EQ( i+1, vec[i] );
 }
 
-TEST(IntVector, PushBack)
+TYPED_TEST(IntVector, PushBack)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec;
+    TypeParam vec;
 
     ASSERT_TRUE( vec.empty() );
     for ( auto i{0} ; i < 5 ; ++i )
@@ -216,10 +274,10 @@ TEST(IntVector, PushBack)
         ASSERT_EQ( i+1, vec[i] );
 }
 
-TEST(IntVector, PopBack)
+TYPED_TEST(IntVector, PopBack)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec{ 1, 2, 3, 4, 5 };
 
     while( not vec.empty() )
     {
@@ -230,10 +288,10 @@ TEST(IntVector, PopBack)
     }
 }
 
-TEST(IntVector, PopFront)
+TYPED_TEST(IntVector, PopFront)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec{ 1, 2, 3, 4, 5 };
 
     auto start{2};
     while( not vec.empty() )
@@ -247,10 +305,10 @@ TEST(IntVector, PopFront)
     }
 }
 
-TEST(IntVector, Front)
+TYPED_TEST(IntVector, Front)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec{ 1, 2, 3, 4, 5 };
 
     auto i{0};
     while( not vec.empty() )
@@ -264,20 +322,20 @@ TEST(IntVector, Front)
         vec.pop_front();
     }
 }
-TEST(IntVector, FrontConst)
+TYPED_TEST(IntVector, FrontConst)
 {
     // #1 From an empty vector.
-    const sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    const TypeParam vec{ 1, 2, 3, 4, 5 };
     ASSERT_EQ( vec.front(), 1 );
 
-    const sc::vector<char> vec2{ 'a', 'e', 'i', 'o', 'u' };
+    const vector_of<TypeParam, char> vec2{ 'a', 'e', 'i', 'o', 'u' };
     ASSERT_EQ( vec2.front(), 'a' );
 }
 
-TEST(IntVector, Back)
+TYPED_TEST(IntVector, Back)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    TypeParam vec{ 1, 2, 3, 4, 5 };
 
     auto i{5};
     while( not vec.empty() )
@@ -291,20 +349,20 @@ TEST(IntVector, Back)
     }
 }
 
-TEST(IntVector, BackConst)
+TYPED_TEST(IntVector, BackConst)
 {
     // #1 From an empty vector.
-    const sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    const TypeParam vec{ 1, 2, 3, 4, 5 };
     ASSERT_EQ( vec.back(), 5 );
 
-    const sc::vector<char> vec2{ 'a', 'e', 'i', 'o', 'u' };
+    const vector_of<TypeParam, char> vec2{ 'a', 'e', 'i', 'o', 'u' };
     ASSERT_EQ( vec2.back(), 'u' );
 }
 
-TEST(IntVector, AssignCountValue)
+TYPED_TEST(IntVector, AssignCountValue)
 {
     // #1 From an empty vector.
-    sc::vector<long> vec{ 1, 2, 3, 4, 5 };
+    vector_of<TypeParam, long> vec{ 1, 2, 3, 4, 5 };
 
     ASSERT_EQ( vec.size(), 5 );
     auto original_cap = vec.capacity();
@@ -331,19 +389,19 @@ TEST(IntVector, AssignCountValue)
 
 
 
-TEST(IntVector, OperatorBracketsRHS)
+TYPED_TEST(IntVector, OperatorBracketsRHS)
 {
-    const sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    const sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
+    const TypeParam vec { 1, 2, 3, 4, 5 };
+    const TypeParam vec2 { 1, 2, 3, 4, 5 };
 
     for ( auto i{0u} ; i < vec.size() ; ++i )
         ASSERT_EQ( vec[i], vec2[i]);
 }
 
-TEST(IntVector, OperatorBracketsLHS)
+TYPED_TEST(IntVector, OperatorBracketsLHS)
 {
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 10, 20, 30, 40, 50 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 10, 20, 30, 40, 50 };
 
     for ( auto i{0u} ; i < vec.size() ; ++i )
         vec[i] = vec2[i];
@@ -351,10 +409,10 @@ TEST(IntVector, OperatorBracketsLHS)
         ASSERT_EQ( vec[i], vec2[i]);
 }
 
-TEST(IntVector, AtRHS)
+TYPED_TEST(IntVector, AtRHS)
 {
-    const sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    const sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
+    const TypeParam vec { 1, 2, 3, 4, 5 };
+    const TypeParam vec2 { 1, 2, 3, 4, 5 };
 
     for ( auto i{0u} ; i < vec.size() ; ++i )
         ASSERT_EQ( vec.at(i), vec2.at(i));
@@ -367,10 +425,10 @@ TEST(IntVector, AtRHS)
     ASSERT_TRUE( worked );
 }
 
-TEST(IntVector, AtLHS)
+TYPED_TEST(IntVector, AtLHS)
 {
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 10, 20, 30, 40, 50 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 10, 20, 30, 40, 50 };
 
     for ( auto i{0u} ; i < vec.size() ; ++i )
         vec.at(i) = vec2.at(i);
@@ -385,183 +443,281 @@ TEST(IntVector, AtLHS)
     ASSERT_TRUE( worked );
 }
 
-TEST(IntVector, Capacity)
+TYPED_TEST(IntVector, Capacity)
 {
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
 
-    ASSERT_EQ( vec.capacity(), 5u );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     vec.reserve(10);
-    ASSERT_EQ( vec.capacity(), 10u );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 10 ) );
     vec.reserve(3); // Nothing happens here.
-    ASSERT_EQ( vec.capacity(), 10u );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 10 ) );
 
     auto i{0};
     for( const auto & e : vec )
         ASSERT_EQ( e, ++i );
 }
 
-TEST(IntVector, ShrinkToFit)
+TYPED_TEST(IntVector, ShrinkToFit)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
 
-    ASSERT_EQ( vec.capacity(), 5u );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     vec.pop_back();
     vec.pop_back();
-    ASSERT_EQ( vec.capacity(), 5u );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 5 ) );
     vec.shrink_to_fit();
-    ASSERT_EQ( vec.capacity(), 3 );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 3 ) );
     auto i{0};
     for( const auto & e : vec )
         ASSERT_EQ( e , ++i );
 }
 
-TEST(IntVector, OperatorEqual)
+TEST(IntVector, Trim)
+{
+    sc::vector<int> vec;
+    for ( auto i{0} ; i < 100 ; ++i )
+        vec.push_back( i );
+    ASSERT_EQ( vec.capacity(), 128u );
+    auto before = vec.data();
+
+    // Above the threshold nothing happens.
+    vec.resize( 80 );
+    vec.trim();
+    ASSERT_EQ( vec.data(), before );
+
+    vec.resize( 10 );
+    vec.trim();
+    ASSERT_EQ( vec.capacity(), 10u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], int(i) );
+
+    // Huge blocks keep their address range and release the pages past the end in place.
+    sc::vector<char> big;
+    big.resize_for_overwrite( sc::growth::release_in_place_bytes );
+    big[0] = 'x';
+    auto storage = big.data();
+    big.resize( 1 );
+    big.trim();
+    ASSERT_EQ( big.data(), storage );
+    ASSERT_EQ( big.capacity(), sc::growth::release_in_place_bytes );
+    ASSERT_EQ( big[0], 'x' );
+    big.resize( 4096 * 3 );
+    ASSERT_EQ( big[4096 * 2], 0 );
+}
+
+TEST(IntVector, AutoTrim)
+{
+    sc::vector<int, std::allocator<int>, sc::growth::trimmed<> > vec;
+    for ( auto i{0} ; i < 1000 ; ++i )
+        vec.push_back( i );
+    ASSERT_EQ( vec.capacity(), 1024u );
+
+    // Draining below a quarter of the capacity halves the slack, never below size().
+    while ( vec.size() > 300 )
+        vec.pop_back();
+    ASSERT_EQ( vec.capacity(), 1024u );
+    vec.pop_back();
+    vec.pop_back();
+    vec.pop_back();
+    ASSERT_EQ( vec.size(), 297u );
+    ASSERT_EQ( vec.capacity(), 1024u );
+    vec.erase( vec.begin(), vec.begin() + 42 );
+    ASSERT_EQ( vec.size(), 255u );
+    ASSERT_EQ( vec.capacity(), 510u );
+    ASSERT_EQ( vec.front(), 42 );
+    ASSERT_EQ( vec.back(), 296 );
+
+    vec.resize( 130 );
+    ASSERT_EQ( vec.capacity(), 510u );
+    vec.resize( 100 );
+    ASSERT_EQ( vec.capacity(), 200u );
+    vec.resize( 10 );
+    ASSERT_EQ( vec.capacity(), 20u );
+
+    // A spike that drains completely gives everything back except the policy's minimum block.
+    vec.resize( 100000 );
+    vec.clear();
+    ASSERT_EQ( vec.capacity(), 16u );
+    vec.push_back( 1 );
+    vec.pop_back();
+    ASSERT_EQ( vec.capacity(), 16u );
+
+    // Only an explicit request frees the whole block.
+    vec.shrink_to_fit();
+    ASSERT_EQ( vec.capacity(), 0u );
+    ASSERT_EQ( vec.data(), nullptr );
+}
+
+TYPED_TEST(IntVector, OperatorEqual)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec3 { 1, 2, 8, 4, 5 };
-    sc::vector<int> vec4 { 8, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 1, 2, 3, 4, 5 };
+    TypeParam vec3 { 1, 2, 8, 4, 5 };
+    TypeParam vec4 { 8, 4, 5 };
 
     ASSERT_EQ( vec , vec2 );
     ASSERT_TRUE( not ( vec == vec3 ) );
     ASSERT_TRUE( not ( vec == vec4 ) );
 }
 
-TEST(IntVector, OperatorDifferent)
+TYPED_TEST(IntVector, OperatorDifferent)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec3 { 1, 2, 8, 4, 5 };
-    sc::vector<int> vec4 { 8, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 1, 2, 3, 4, 5 };
+    TypeParam vec3 { 1, 2, 8, 4, 5 };
+    TypeParam vec4 { 8, 4, 5 };
 
     ASSERT_TRUE( not( vec != vec2 ) );
     ASSERT_NE( vec, vec3 );
     ASSERT_NE( vec,vec4 );
 }
 
-TEST(IntVector, InsertSingleValueAtPosition)
+TYPED_TEST(IntVector, InsertSingleValueAtPosition)
 {
     // #1 From an empty vector.
-    sc::vector<int> vec { 1, 2, 4, 5, 6 };
+    TypeParam vec { 1, 2, 4, 5, 6 };
 
     // Insert at front
     vec.insert( vec.begin(), 0 );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 0, 1, 2, 4, 5, 6 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 0, 1, 2, 4, 5, 6 } ) );
     // Insert in the middle
     vec.insert( vec.begin()+3, 3 );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 0, 1, 2, 3, 4, 5, 6 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 0, 1, 2, 3, 4, 5, 6 } ) );
     // Insert at the end
     vec.insert( vec.end(), 7 );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 0, 1, 2, 3, 4, 5, 6, 7 } ) );
 }
 
-TEST(IntVector, InsertRange)
+TYPED_TEST(IntVector, InsertRange)
 {
     // Aux arrays.
-    sc::vector<int> vec1 { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
-    sc::vector<int> source { 6, 7, 8, 9, 10 };
+    TypeParam vec1 { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 1, 2, 3, 4, 5 };
+    TypeParam source { 6, 7, 8, 9, 10 };
 
     // Inset at the begining.
     vec1.insert( vec1.begin(), source.begin(), source.end() );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 6, 7, 8, 9, 10, 1, 2, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 6, 7, 8, 9, 10, 1, 2, 3, 4, 5 } ) );
 
     // In the middle
     vec1 = vec2;
     vec1.insert( std::next( vec1.begin(), 2 ), source.begin(), source.end() );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 6, 7, 8, 9, 10, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 6, 7, 8, 9, 10, 3, 4, 5 } ) );
 
     // At the end
     vec1 = vec2;
     vec1.insert( vec1.end(), source.begin(), source.end() );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) );
 
     // Outside
     vec1 = vec2;
     vec1.insert( std::next( vec1.end(), 2 ) , source.begin(), source.end() );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 3, 4, 5 } ) );
+
+}
 
+TYPED_TEST(IntVector, InputIteratorRanges)
+{
+    // Single-pass ranges are read once by the range constructor, assign() and insert().
+    std::istringstream in1( "1 2 3 4" );
+    TypeParam vec{ std::istream_iterator<int>( in1 ), std::istream_iterator<int>() };
+    ASSERT_EQ( vec, ( TypeParam{ 1, 2, 3, 4 } ) );
+
+    std::istringstream in2( "5 6 7 8 9" );
+    vec.assign( std::istream_iterator<int>( in2 ), std::istream_iterator<int>() );
+    ASSERT_EQ( vec, ( TypeParam{ 5, 6, 7, 8, 9 } ) );
+
+    std::istringstream in3( "1 2 3 4" );
+    auto it = vec.insert( std::next( vec.begin(), 2 ), std::istream_iterator<int>( in3 ), std::istream_iterator<int>() );
+    ASSERT_EQ( vec, ( TypeParam{ 5, 6, 1, 2, 3, 4, 7, 8, 9 } ) );
+    ASSERT_EQ( *it, 1 );
+
+    std::istringstream in4( "a b c" );
+    vector_of<TypeParam, std::string> words{ "x", "y" };
+    words.insert( words.begin(), std::istream_iterator<std::string>( in4 ), std::istream_iterator<std::string>() );
+    ASSERT_EQ( words, ( vector_of<TypeParam, std::string>{ "a", "b", "c", "x", "y" } ) );
 }
 
-TEST(IntVector, InsertInitializarList)
+TYPED_TEST(IntVector, InsertInitializarList)
 {
     // Aux arrays.
-    sc::vector<int> vec1 { 1, 2, 3, 4, 5 };
-    sc::vector<int> vec2 { 1, 2, 3, 4, 5 };
-    sc::vector<int> source { 6, 7, 8, 9, 10 };
+    TypeParam vec1 { 1, 2, 3, 4, 5 };
+    TypeParam vec2 { 1, 2, 3, 4, 5 };
+    TypeParam source { 6, 7, 8, 9, 10 };
 
     // Inset at the begining.
     vec1.insert( vec1.begin(), { 6, 7, 8, 9, 10 } );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 6, 7, 8, 9, 10, 1, 2, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 6, 7, 8, 9, 10, 1, 2, 3, 4, 5 } ) );
 
     // In the middle
     vec1 = vec2;
     vec1.insert( std::next( vec1.begin(), 2 ), { 6, 7, 8, 9, 10 } );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 6, 7, 8, 9, 10, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 6, 7, 8, 9, 10, 3, 4, 5 } ) );
 
     // At the end
     vec1 = vec2;
     vec1.insert( vec1.end(), { 6, 7, 8, 9, 10 } );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) );
 
     // Outside
     vec1 = vec2;
     vec1.insert( std::next( vec1.end(), 2 ) , { 6, 7, 8, 9, 10 } );
-    ASSERT_EQ( vec1 , ( sc::vector<int>{ 1, 2, 3, 4, 5 } ) );
+    ASSERT_EQ( vec1 , ( TypeParam{ 1, 2, 3, 4, 5 } ) );
 }
 
-TEST(IntVector, AssignCountValue2)
+TYPED_TEST(IntVector, AssignCountValue2)
 {
         // Initial vector.
-        sc::vector<char> vec { 'a', 'b', 'c', 'd', 'e' };
+        vector_of<TypeParam, char> vec { 'a', 'b', 'c', 'd', 'e' };
 
         // assigning count values to sc::vector, with count < size().
         vec.assign( 3, 'x' );
-        ASSERT_EQ( vec , ( sc::vector<char>{ 'x', 'x', 'x' } ) );
+        ASSERT_EQ( vec , ( vector_of<TypeParam, char>{ 'x', 'x', 'x' } ) );
         ASSERT_EQ( vec.size() , 3 );
-        ASSERT_EQ( vec.capacity() , 5 );
+        ASSERT_EQ( vec.capacity() , capacity_for<decltype( vec )>( 5 ) );
 
         // assigning count values to sc::vector, with count , size().
         vec = { 'a', 'b', 'c', 'd', 'e' };
         vec.assign( 5, 'y' );
-        ASSERT_EQ( vec , ( sc::vector<char>{ 'y','y','y','y','y' } ) );
+        ASSERT_EQ( vec , ( vector_of<TypeParam, char>{ 'y','y','y','y','y' } ) );
         ASSERT_EQ( vec.size() , 5 );
-        ASSERT_EQ( vec.capacity() , 5 );
+        ASSERT_EQ( vec.capacity() , capacity_for<decltype( vec )>( 5 ) );
 
         // assigning count values to sc::vector, with count > size().
         vec = { 'a', 'b', 'c', 'd', 'e' };
         vec.assign( 8, 'z' );
-        ASSERT_EQ( vec , ( sc::vector<char>{ 'z','z','z','z','z','z','z','z' } ) );
+        ASSERT_EQ( vec , ( vector_of<TypeParam, char>{ 'z','z','z','z','z','z','z','z' } ) );
         ASSERT_EQ( vec.size() , 8 );
-        ASSERT_EQ( vec.capacity() , 8 );
+        ASSERT_EQ( vec.capacity() , capacity_for<decltype( vec )>( 8 ) );
 }
 
-TEST(IntVector, EraseRange)
+TYPED_TEST(IntVector, EraseRange)
 {
     // Initial vector.
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
 
     // removing a segment from the beginning.
     auto past_last = vec.erase( vec.begin(), std::next(vec.begin(),3) );
     ASSERT_EQ( vec.begin() , past_last );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 4, 5 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 4, 5 } ) );
     ASSERT_EQ( vec.size() , 2 );
 
     // removing at the middle.
     vec = { 1, 2, 3, 4, 5 };
     past_last = vec.erase( std::next(vec.begin(),1), std::next(vec.begin(),4) );
     ASSERT_EQ( std::next(vec.begin(),1) , past_last );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 1, 5 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 1, 5 } ) );
     ASSERT_EQ( vec.size() , 2 );
 
     // removing a segment that reached the end.
     vec = { 1, 2, 3, 4, 5 };
     past_last = vec.erase( std::next(vec.begin(),2), vec.end() );
     ASSERT_EQ( vec.end() , past_last );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 1, 2 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 1, 2 } ) );
     ASSERT_EQ( vec.size() , 2 );
 
     // removing the entire vector.
@@ -571,33 +727,321 @@ TEST(IntVector, EraseRange)
     ASSERT_TRUE( vec.empty() );
 }
 
-TEST(IntVector, ErasePos)
+TYPED_TEST(IntVector, ErasePos)
 {
     // Initial vector.
-    sc::vector<int> vec { 1, 2, 3, 4, 5 };
+    TypeParam vec { 1, 2, 3, 4, 5 };
 
     // removing a single element.
     vec = { 1, 2, 3, 4, 5 };
     auto past_last = vec.erase( vec.begin() );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 2, 3, 4, 5 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 2, 3, 4, 5 } ) );
     ASSERT_EQ( vec.begin() , past_last );
     ASSERT_EQ( vec.size() , 4 );
 
     // removing a single element in the middle.
     vec = { 1, 2, 3, 4, 5 };
     past_last = vec.erase( std::next(vec.begin(),2) );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 1, 2, 4, 5 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 1, 2, 4, 5 } ) );
     ASSERT_EQ( std::next(vec.begin(),2) , past_last );
     ASSERT_EQ( vec.size() , 4 );
 
     // removing a single element at the end.
     vec = { 1, 2, 3, 4, 5 };
     past_last = vec.erase( std::next(vec.begin(),vec.size()-1 ) );
-    ASSERT_EQ( vec , ( sc::vector<int>{ 1, 2, 3, 4 } ) );
+    ASSERT_EQ( vec , ( TypeParam{ 1, 2, 3, 4 } ) );
     ASSERT_EQ( vec.end() , past_last );
     ASSERT_EQ( vec.size() , 4 );
 }
 
+TYPED_TEST(IntVector, EmplaceBack)
+{
+    vector_of<TypeParam, std::pair<int,int>> vec;
+
+    for ( auto i{0} ; i < 5 ; ++i )
+    {
+        auto & e = vec.emplace_back( i, i*10 );
+        ASSERT_EQ( e.second, i*10 );
+        ASSERT_EQ( vec.size(), i+1 );
+    }
+    for( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], std::make_pair( int(i), int(i*10) ) );
+
+    // The argument may refer to an element that is moved by the growth.
+    vector_of<TypeParam, std::string> strs{ "a" };
+    for ( auto i{0} ; i < 10 ; ++i )
+        strs.emplace_back( strs[0] );
+    ASSERT_EQ( strs.size(), 11 );
+    for( const auto & e : strs )
+        ASSERT_EQ( e, "a" );
+}
+
+TYPED_TEST(IntVector, EmplacePos)
+{
+    vector_of<TypeParam, std::string> vec{ "a", "d" };
+
+    auto it = vec.emplace( std::next( vec.begin(), 1 ), 2, 'c' );
+    ASSERT_EQ( *it, "cc" );
+    vec.emplace( std::next( vec.begin(), 1 ), "b" );
+    vec.emplace( vec.end(), "e" );
+    vec.emplace_front( "0" );
+    ASSERT_EQ( vec , ( vector_of<TypeParam, std::string>{ "0", "a", "b", "cc", "d", "e" } ) );
+}
+
+TYPED_TEST(IntVector, PushBackMove)
+{
+    vector_of<TypeParam, std::string> vec;
+    std::string value( 100, 'x' );
+
+    vec.push_back( std::move( value ) );
+    vec.push_front( std::string( 100, 'y' ) );
+    vec.insert( vec.end(), std::string( 100, 'z' ) );
+    ASSERT_EQ( vec.size(), 3 );
+    ASSERT_EQ( vec[0], std::string( 100, 'y' ) );
+    ASSERT_EQ( vec[1], std::string( 100, 'x' ) );
+    ASSERT_EQ( vec[2], std::string( 100, 'z' ) );
+}
+
+TYPED_TEST(IntVector, InsertEraseTrivialStruct)
+{
+    // Trivially copyable elements take the memmove/memcpy path.
+    struct Event { int id; double value; };
+    vector_of<TypeParam, Event> vec;
+    for ( auto i{0} ; i < 10 ; ++i )
+        vec.push_back( Event{ i, i * 0.5 } );
+
+    Event extra[] = { { 100, 1.0 }, { 101, 2.0 }, { 102, 3.0 } };
+    vec.insert( std::next( vec.begin(), 4 ), std::begin( extra ), std::end( extra ) );
+    ASSERT_EQ( vec.size(), 13 );
+    ASSERT_EQ( vec[3].id, 3 );
+    ASSERT_EQ( vec[4].id, 100 );
+    ASSERT_EQ( vec[6].id, 102 );
+    ASSERT_EQ( vec[7].id, 4 );
+    ASSERT_EQ( vec[12].id, 9 );
+
+    vec.insert( vec.begin(), Event{ -1, 0.0 } );
+    ASSERT_EQ( vec[0].id, -1 );
+    ASSERT_EQ( vec[1].id, 0 );
+
+    vec.erase( std::next( vec.begin(), 5 ), std::next( vec.begin(), 8 ) );
+    ASSERT_EQ( vec.size(), 11 );
+    for( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i].id, int(i)-1 );
+
+    vec.erase( vec.begin() );
+    ASSERT_EQ( vec.front().id, 0 );
+    ASSERT_EQ( vec.back().id, 9 );
+}
+
+TYPED_TEST(IntVector, InsertEraseStrings)
+{
+    // Non-trivial elements take the move-based path.
+    vector_of<TypeParam, std::string> vec{ "a", "b", "f" };
+    vector_of<TypeParam, std::string> source{ "c", "d", "e" };
+
+    vec.insert( std::next( vec.begin(), 2 ), source.begin(), source.end() );
+    ASSERT_EQ( vec , ( vector_of<TypeParam, std::string>{ "a", "b", "c", "d", "e", "f" } ) );
+    vec.insert( std::next( vec.begin(), 5 ), { "x", "y" } );
+    ASSERT_EQ( vec , ( vector_of<TypeParam, std::string>{ "a", "b", "c", "d", "e", "x", "y", "f" } ) );
+    vec.erase( std::next( vec.begin(), 5 ), std::next( vec.begin(), 7 ) );
+    ASSERT_EQ( vec , ( vector_of<TypeParam, std::string>{ "a", "b", "c", "d", "e", "f" } ) );
+}
+
+TEST(IntVector, GrowthPolicy)
+{
+    // Default policy doubles, starting from an empty vector.
+    sc::vector<int> vec;
+    std::vector<size_t> caps;
+    for ( auto i{0} ; i < 9 ; ++i )
+    {
+        vec.push_back( i );
+        if ( caps.empty() or caps.back() != vec.capacity() )
+            caps.push_back( vec.capacity() );
+    }
+    ASSERT_EQ( caps, ( std::vector<size_t>{ 1, 2, 4, 8, 16 } ) );
+
+    // 1.5x growth.
+    sc::vector<int, std::allocator<int>, sc::growth::one_and_half> vec2;
+    caps.clear();
+    for ( auto i{0} ; i < 20 ; ++i )
+    {
+        vec2.push_back( i );
+        if ( caps.empty() or caps.back() != vec2.capacity() )
+            caps.push_back( vec2.capacity() );
+    }
+    ASSERT_EQ( caps, ( std::vector<size_t>{ 1, 2, 3, 4, 6, 9, 13, 19, 28 } ) );
+    for ( auto i{0u} ; i < vec2.size() ; ++i )
+        ASSERT_EQ( vec2[i], i );
+
+    // Page rounded growth: past one page, the block is a whole number of pages.
+    sc::vector<int, std::allocator<int>, sc::growth::page_rounded<4096>> vec3;
+    for ( auto i{0} ; i < 5000 ; ++i )
+    {
+        vec3.push_back( i );
+        if ( vec3.capacity() * sizeof(int) >= 4096 )
+        {
+            ASSERT_EQ( ( vec3.capacity() * sizeof(int) ) % 4096, 0 );
+        }
+    }
+
+    // A range insertion bigger than the next step grows straight to the required size.
+    sc::vector<int> vec4{ 1, 2 };
+    vec4.insert( vec4.end(), { 3, 4, 5, 6, 7 } );
+    ASSERT_EQ( vec4.capacity(), 7 );
+}
+
+TYPED_TEST(IntVector, AppendRange)
+{
+    TypeParam vec{ 1, 2 };
+    std::vector<int> source( 100 );
+    for ( auto i{0} ; i < 100 ; ++i )
+        source[i] = i + 3;
+
+    // One growth decision for the whole batch: straight to the required size.
+    vec.append_range( source.begin(), source.end() );
+    ASSERT_EQ( vec.size(), 102 );
+    ASSERT_EQ( vec.capacity(), 102 );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], int(i) + 1 );
+
+    // From a raw buffer, e.g. one filled by a decoder.
+    const int buffer[] = { -1, -2, -3 };
+    vec.append( buffer, 3 );
+    ASSERT_EQ( vec.size(), 105 );
+    ASSERT_EQ( vec.back(), -3 );
+    vec.append( buffer, 0 );
+    ASSERT_EQ( vec.size(), 105 );
+
+    // The range may be part of the vector itself, even when it has to grow.
+    vector_of<TypeParam, std::string> words{ "a", "b", "c" };
+    words.shrink_to_fit();
+    words.append_range( words.begin(), words.end() );
+    ASSERT_EQ( words, ( vector_of<TypeParam, std::string>{ "a", "b", "c", "a", "b", "c" } ) );
+}
+
+TYPED_TEST(IntVector, Resize)
+{
+    TypeParam vec{ 1, 2, 3 };
+    vec.resize( 6 );
+    ASSERT_EQ( vec, ( TypeParam{ 1, 2, 3, 0, 0, 0 } ) );
+    vec.resize( 2 );
+    ASSERT_EQ( vec, ( TypeParam{ 1, 2 } ) );
+    ASSERT_EQ( vec.capacity(), capacity_for<TypeParam>( 6 ) );
+    vec.resize( 4, 7 );
+    ASSERT_EQ( vec, ( TypeParam{ 1, 2, 7, 7 } ) );
+
+    vector_of<TypeParam, std::string> words{ "x" };
+    words.shrink_to_fit();
+    // The value may be an element that moves when the vector grows.
+    words.resize( 3, words[0] );
+    ASSERT_EQ( words, ( vector_of<TypeParam, std::string>{ "x", "x", "x" } ) );
+    words.resize( 4 );
+    ASSERT_EQ( words.back(), "" );
+    words.resize( 0 );
+    ASSERT_TRUE( words.empty() );
+}
+
+TYPED_TEST(IntVector, ResizeForOverwrite)
+{
+    vector_of<TypeParam, char> buffer{ 'a' };
+    const char payload[] = "payload";
+    buffer.resize_for_overwrite( 1 + sizeof( payload ) );
+    ASSERT_EQ( buffer.size(), 1 + sizeof( payload ) );
+    std::copy( std::begin( payload ), std::end( payload ), buffer.data() + 1 );
+    ASSERT_EQ( buffer[0], 'a' );
+    ASSERT_EQ( std::string( buffer.data() + 1 ), "payload" );
+    buffer.resize_for_overwrite( 1 );
+    ASSERT_EQ( buffer.size(), 1 );
+
+    // Non-trivial types are still value-initialized.
+    vector_of<TypeParam, std::string> words;
+    words.resize_for_overwrite( 2 );
+    ASSERT_EQ( words, ( vector_of<TypeParam, std::string>{ "", "" } ) );
+}
+
+// ============================================================================
+// TESTING DEVECTOR (FRONT RESERVE) AS A CONTAINER OF INTEGERS
+// ============================================================================
+
+TEST(IntDevector, PushFrontPushBack)
+{
+    sc::devector<int> vec;
+
+    ASSERT_TRUE( vec.empty() );
+    for ( auto i{0} ; i < 5 ; ++i )
+    {
+        vec.push_front( 4-i );
+        vec.push_back( 5+i );
+    }
+    ASSERT_EQ( vec.size(), 10 );
+
+    for( auto i{0u} ; i < vec.size() ; ++i )
+    {
+        ASSERT_EQ( vec[i], i );
+        ASSERT_EQ( vec.data()[i], i );
+    }
+    ASSERT_EQ( vec.front(), 0 );
+    ASSERT_EQ( vec.back(), 9 );
+}
+
+TEST(IntDevector, PopFront)
+{
+    sc::devector<int> vec{ 1, 2, 3, 4, 5 };
+
+    auto start{2};
+    while( not vec.empty() )
+    {
+        vec.pop_front();
+        for( auto i{0u} ; i < vec.size() ; ++i )
+            ASSERT_EQ( start+i, vec[i] );
+
+        start++;
+    }
+}
+
+TEST(IntDevector, SlidingWindow)
+{
+    // A window of fixed size sliding forward must not keep growing the buffer.
+    sc::devector<int> vec;
+    for ( auto i{0} ; i < 16 ; ++i )
+        vec.push_back( i );
+    auto cap = vec.capacity();
+
+    for ( auto i{16} ; i < 10000 ; ++i )
+    {
+        vec.pop_front();
+        vec.push_back( i );
+        ASSERT_EQ( vec.front(), i-15 );
+        ASSERT_EQ( vec.back(), i );
+    }
+    ASSERT_EQ( vec.size(), 16 );
+    ASSERT_EQ( vec.capacity(), cap );
+
+    auto i{10000-16};
+    for( auto it = vec.begin() ; it != vec.end() ; ++it )
+        ASSERT_EQ( *it, i++ );
+}
+
+TEST(IntDevector, CopyAndMove)
+{
+    sc::devector<std::string> vec;
+    vec.push_front( "b" );
+    vec.push_front( "a" );
+    vec.push_back( "c" );
+
+    sc::devector<std::string> vec2( vec );
+    ASSERT_EQ( vec2, vec );
+
+    sc::devector<std::string> vec3( std::move( vec ) );
+    ASSERT_TRUE( vec.empty() );
+    ASSERT_EQ( vec3, vec2 );
+
+    vec = vec3;
+    vec.emplace_front( 3, 'z' );
+    ASSERT_EQ( vec.front(), "zzz" );
+    ASSERT_EQ( vec.size(), 4 );
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
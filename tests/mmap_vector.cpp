@@ -0,0 +1,157 @@
+#include <cstdio>               // std::remove
+#include <iterator>             // std::istream_iterator
+#include <sstream>              // std::istringstream
+#include <stdexcept>            // std::runtime_error, std::logic_error, std::out_of_range
+#include <string>               // std::string, std::to_string
+#include <system_error>         // std::system_error
+
+#include <unistd.h>             // getpid
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/mmap_vector.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING MMAP_VECTOR
+// ============================================================================
+
+// A file in /tmp, removed when the test ends.
+class MmapVector : public ::testing::Test
+{
+    protected:
+        std::string path;
+
+        void SetUp() override
+        {
+            path = "/tmp/sc_mmap_vector_" + std::to_string( getpid() ) + "_" +
+                   ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+            std::remove( path.c_str() );
+        }
+        void TearDown() override
+        {
+            std::remove( path.c_str() );
+        }
+};
+
+struct Pod {
+    int id;
+    double x, y;
+};
+
+TEST_F(MmapVector, PersistsAcrossReopen)
+{
+    {
+        sc::mmap_vector<int> vec( path );
+        ASSERT_TRUE( vec.empty() );
+        for ( auto i{0} ; i < 100000 ; ++i )
+            vec.push_back( i );
+        ASSERT_EQ( vec.size(), 100000u );
+        ASSERT_GE( vec.capacity(), 100000u );
+    }
+    sc::mmap_vector<int> vec( path );
+    ASSERT_EQ( vec.size(), 100000u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], i );
+
+    // Continues growing where it stopped.
+    vec.push_back( -1 );
+    ASSERT_EQ( vec.back(), -1 );
+    ASSERT_EQ( vec.front(), 0 );
+}
+
+TEST_F(MmapVector, SnapshotAndReadOnlyReload)
+{
+    sc::vector<Pod> state;
+    for ( auto i{0} ; i < 5000 ; ++i )
+        state.push_back( Pod{ i, i * 0.5, i * 2.0 } );
+
+    {
+        sc::mmap_vector<Pod> snapshot( path, sc::open_mode::truncate );
+        snapshot.assign( state.begin(), state.end() );
+        snapshot.sync();
+    }
+
+    const sc::mmap_vector<Pod> reloaded( path, sc::open_mode::read_only );
+    ASSERT_TRUE( reloaded.read_only() );
+    ASSERT_EQ( reloaded.size(), state.size() );
+    ASSERT_EQ( reloaded.at( 4999 ).id, 4999 );
+    ASSERT_EQ( reloaded[10].y, 20.0 );
+    ASSERT_THROW( reloaded.at( 5000 ), std::out_of_range );
+
+    sc::vector<Pod> copy = reloaded.to_vector();
+    ASSERT_EQ( copy.size(), state.size() );
+    ASSERT_EQ( copy[1234].x, state[1234].x );
+}
+
+TEST_F(MmapVector, ReadOnlyRejectsChanges)
+{
+    {
+        sc::mmap_vector<int> vec( path );
+        vec.assign( 10, 7 );
+    }
+    sc::mmap_vector<int> vec( path, sc::open_mode::read_only );
+    ASSERT_THROW( vec.push_back( 1 ), std::logic_error );
+    ASSERT_THROW( vec.reserve( 100 ), std::logic_error );
+    ASSERT_THROW( vec.clear(), std::logic_error );
+    ASSERT_EQ( vec.size(), 10u );
+}
+
+TEST_F(MmapVector, RejectsOtherTypesAndMissingFiles)
+{
+    {
+        sc::mmap_vector<int> vec( path );
+        vec.push_back( 1 );
+    }
+    ASSERT_THROW( sc::mmap_vector<float>( path, sc::open_mode::read_only ), std::runtime_error );
+    ASSERT_THROW( sc::mmap_vector<Pod>( path, sc::open_mode::read_write ), std::runtime_error );
+    ASSERT_THROW( sc::mmap_vector<int>( path + ".missing", sc::open_mode::read_only ), std::system_error );
+
+    // truncate discards the old content, whatever its type.
+    sc::mmap_vector<Pod> vec( path, sc::open_mode::truncate );
+    ASSERT_TRUE( vec.empty() );
+}
+
+TEST_F(MmapVector, InsertEraseAndShrink)
+{
+    sc::mmap_vector<int> vec( path );
+    int values[] = { 1, 2, 3, 4, 5 };
+    vec.insert( vec.cbegin(), values, values + 5 );
+    vec.insert( vec.cbegin() + 2, 10 );
+    vec.erase( vec.cbegin(), vec.cbegin() + 1 );
+
+    int expected[] = { 2, 10, 3, 4, 5 };
+    ASSERT_EQ( vec.size(), 5u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], expected[i] );
+
+    vec.shrink_to_fit();
+    ASSERT_EQ( vec.capacity(), 5u );
+    vec.pop_back();
+    ASSERT_EQ( vec.back(), 4 );
+
+    sc::mmap_vector<int> moved( std::move( vec ) );
+    ASSERT_FALSE( vec.is_open() );
+    ASSERT_EQ( moved.size(), 4u );
+    ASSERT_EQ( moved[1], 10 );
+}
+
+TEST_F(MmapVector, SinglePassRanges)
+{
+    sc::mmap_vector<int> vec( path );
+    vec.push_back( 9 );
+
+    std::istringstream in1( "1 2 3 4" );
+    vec.assign( std::istream_iterator<int>( in1 ), std::istream_iterator<int>() );
+    ASSERT_EQ( vec.size(), 4u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], i + 1 );
+
+    std::istringstream in2( "7 8" );
+    auto it = vec.insert( vec.cbegin() + 1, std::istream_iterator<int>( in2 ), std::istream_iterator<int>() );
+    ASSERT_EQ( *it, 7 );
+
+    int expected[] = { 1, 7, 8, 2, 3, 4 };
+    ASSERT_EQ( vec.size(), 6u );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], expected[i] );
+}
@@ -0,0 +1,207 @@
+#include <algorithm>            // std::is_sorted, std::equal
+#include <atomic>               // std::atomic
+#include <random>               // std::mt19937
+#include <stdexcept>            // std::runtime_error
+#include <string>               // std::string
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/parallel.h"   // header file for tested functions
+#include "../include/aligned_allocator.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING THE PARALLEL ALGORITHMS
+// ============================================================================
+// The serial cutoff is lowered so that small vectors are already split
+// across several threads.
+
+class Parallel : public ::testing::Test
+{
+    protected:
+        std::size_t threads = sc::parallel::thread_count();
+        std::size_t cutoff = sc::parallel::serial_cutoff();
+
+        void SetUp( void ) override
+        {
+            sc::parallel::set_thread_count( 4 );
+            sc::parallel::set_serial_cutoff( 1000 );
+        }
+        void TearDown( void ) override
+        {
+            sc::parallel::set_thread_count( threads );
+            sc::parallel::set_serial_cutoff( cutoff );
+        }
+};
+
+sc::vector<int> iota( int n )
+{
+    sc::vector<int> vec( n );
+    for ( auto i{0} ; i < n ; ++i )
+        vec.push_back( i );
+    return vec;
+}
+
+TEST_F(Parallel, PartitionCoversTheRange)
+{
+    sc::vector<int> vec = iota( 100003 );
+    auto p = sc::parallel::split( vec.data(), vec.size() );
+    ASSERT_GT( p.chunks, 1u );
+    ASSERT_EQ( p.boundary( 0 ), 0u );
+    ASSERT_EQ( p.boundary( p.chunks ), vec.size() );
+    for ( std::size_t k = 1 ; k < p.chunks ; ++k )
+    {
+        ASSERT_LE( p.boundary( k - 1 ), p.boundary( k ) );
+        // Cada bloco interno começa numa linha de cache.
+        ASSERT_EQ( reinterpret_cast<std::uintptr_t>( vec.data() + p.boundary( k ) ) % sc::parallel::cache_line, 0u );
+    }
+
+    // Abaixo do limite tudo fica num único bloco.
+    ASSERT_EQ( sc::parallel::split( vec.data(), 999 ).chunks, 1u );
+
+    // 12 bytes não dividem 64: o limite avança até um elemento que comece numa linha.
+    struct Triple { int a, b, c; };
+    sc::vector<Triple> triples;
+    triples.resize( 100003 );
+    auto q = sc::parallel::split( triples.data(), triples.size() );
+    ASSERT_GT( q.chunks, 1u );
+    ASSERT_EQ( q.boundary( q.chunks ), triples.size() );
+    for ( std::size_t k = 1 ; k < q.chunks ; ++k )
+    {
+        ASSERT_LE( q.boundary( k - 1 ), q.boundary( k ) );
+        ASSERT_EQ( reinterpret_cast<std::uintptr_t>( triples.data() + q.boundary( k ) ) % sc::parallel::cache_line, 0u );
+    }
+}
+
+TEST_F(Parallel, ForEach)
+{
+    sc::vector<int> vec = iota( 100000 );
+    sc::parallel::for_each( vec, []( int & x ) { x *= 2; } );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], 2 * i );
+}
+
+TEST_F(Parallel, Transform)
+{
+    sc::vector<int> in = iota( 100000 );
+    sc::vector<std::string> out;
+    sc::parallel::transform( in, out, []( int x ) { return std::to_string( x ); } );
+    ASSERT_EQ( out.size(), in.size() );
+    for ( auto i{0u} ; i < in.size() ; ++i )
+        ASSERT_EQ( out[i], std::to_string( i ) );
+
+    // Em uma mesma lista.
+    sc::parallel::transform( in, in, []( int x ) { return x + 1; } );
+    ASSERT_EQ( in[0], 1 );
+    ASSERT_EQ( in[99999], 100000 );
+}
+
+TEST_F(Parallel, Reduce)
+{
+    sc::vector<int> vec = iota( 100000 );
+    ASSERT_EQ( sc::parallel::reduce( vec, 0LL ), 4999950000LL );
+
+    // Operação associativa mas não comutativa: os blocos são combinados em ordem.
+    sc::vector<std::string> words;
+    for ( auto i{0} ; i < 5000 ; ++i )
+        words.push_back( std::string( 1, 'a' + i % 26 ) );
+    std::string expected;
+    for ( auto & w : words )
+        expected += w;
+    ASSERT_EQ( sc::parallel::reduce( words, std::string() ), expected );
+}
+
+TEST_F(Parallel, Sort)
+{
+    std::mt19937 gen( 7 );
+    for ( int n : { 0, 10, 999, 1000, 12345, 200000 } )
+    {
+        sc::vector<int> vec( n );
+        for ( auto i{0} ; i < n ; ++i )
+            vec.push_back( static_cast<int>( gen() % 1000 ) );
+        long long sum = sc::sum( vec );
+
+        sc::parallel::sort( vec );
+        ASSERT_TRUE( std::is_sorted( vec.begin(), vec.end() ) );
+        ASSERT_EQ( sc::sum( vec ), sum );
+    }
+
+    sc::vector<int> desc = iota( 50000 );
+    sc::parallel::sort( desc, []( int a, int b ) { return a > b; } );
+    ASSERT_EQ( desc.front(), 49999 );
+    ASSERT_EQ( desc.back(), 0 );
+}
+
+TEST_F(Parallel, Fill)
+{
+    sc::vector<int> vec = iota( 100000 );
+    sc::parallel::fill( vec, vec[500] );   // value aponta para dentro da lista
+    ASSERT_EQ( sc::count( vec, 500 ), 100000u );
+}
+
+TEST_F(Parallel, VectorUsesParallelFillAndCopy)
+{
+    // Bulk fills and copies stay on the calling thread by default, and use the pool with aligned_allocator.
+    sc::vector<int> vec;
+    vec.assign( 100000, 7 );
+    ASSERT_EQ( sc::count( vec, 7 ), 100000u );
+
+    sc::vector<int> copy( vec );
+    ASSERT_EQ( copy, vec );
+
+    vec.assign( 50000, vec[10] );
+    ASSERT_EQ( vec.size(), 50000u );
+    ASSERT_EQ( sc::count( vec, 7 ), 50000u );
+
+    sc::aligned_vector<int> filled;
+    filled.assign( 100000, 7 );
+    ASSERT_EQ( sc::count( filled, 7 ), 100000u );
+    filled.assign( 50000, filled[10] );
+    ASSERT_EQ( sc::count( filled, 7 ), 50000u );
+    filled.append_range( copy.begin(), copy.end() );
+    sc::aligned_vector<int> filled_copy( filled );
+    ASSERT_EQ( filled_copy, filled );
+    ASSERT_EQ( sc::count( filled_copy, 7 ), 150000u );
+
+    // Growth and zeroing as well.
+    sc::vector<int> grown = iota( 100000 );
+    grown.reserve( 300000 );
+    grown.resize( 200000 );
+    for ( auto i{0u} ; i < 100000u ; ++i )
+        ASSERT_EQ( grown[i], int(i) );
+    ASSERT_EQ( sc::count( grown, 0 ), 100001u );
+
+    sc::aligned_vector<int> touched;
+    touched.assign( grown.begin(), grown.end() );
+    touched.reserve( 300000 );
+    touched.resize( 250000 );
+    ASSERT_TRUE( std::equal( grown.begin(), grown.end(), touched.begin() ) );
+    ASSERT_EQ( sc::count( touched, 0 ), 150001u );
+}
+
+TEST_F(Parallel, ExceptionsReachTheCaller)
+{
+    sc::vector<int> vec = iota( 100000 );
+    ASSERT_THROW( sc::parallel::for_each( vec, []( int & x ) {
+        if ( x == 77777 )
+            throw std::runtime_error( "boom" );
+    } ), std::runtime_error );
+}
+
+TEST_F(Parallel, SerialWithOneThread)
+{
+    sc::parallel::set_thread_count( 1 );
+    sc::vector<int> vec = iota( 100000 );
+    ASSERT_EQ( sc::parallel::split( vec.data(), vec.size() ).chunks, 1u );
+    sc::parallel::sort( vec, []( int a, int b ) { return a > b; } );
+    ASSERT_EQ( vec.front(), 99999 );
+}
+
+TEST(ThreadPool, NestedRunsDoNotDeadlock)
+{
+    sc::thread_pool pool( 2 );
+    std::atomic<int> total{0};
+    pool.run( 8, [&]( std::size_t ) {
+        pool.run( 8, [&]( std::size_t ) { total++; } );
+    } );
+    ASSERT_EQ( total, 64 );
+}
@@ -0,0 +1,285 @@
+#include <cstdint>              // std::uint64_t
+#include <cstdio>               // std::tmpfile, std::fileno
+#include <sstream>              // std::stringstream
+#include <stdexcept>            // std::runtime_error
+#include <string>               // std::string
+#include <thread>               // std::thread
+
+#include <sys/socket.h>         // socketpair, recv
+#include <unistd.h>             // lseek, close
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/serialize.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING BINARY SERIALIZATION
+// ============================================================================
+
+struct Sample {
+    int id;
+    float value;
+};
+
+// A type that is neither trivially copyable nor a string: serialized field by field.
+struct Named {
+    std::string name;
+    int score;
+};
+
+namespace sc {
+    template <>
+    struct serializer<Named> {
+        static constexpr bool bulk = false;
+
+        template <typename Sink>
+        static void write( Sink & out, const Named & value )
+        {
+            serializer<std::string>::write( out, value.name );
+            io::write_value( out, value.score );
+        }
+        template <typename Source>
+        static void read( Source & in, Named & value )
+        {
+            serializer<std::string>::read( in, value.name );
+            value.score = io::read_value<int>( in );
+        }
+    };
+}
+
+TEST(Serialize, TriviallyCopyableThroughStream)
+{
+    sc::vector<int> vec;
+    for ( auto i{0} ; i < 10000 ; ++i )
+        vec.push_back( i * 3 );
+
+    std::stringstream stream;
+    sc::serialize( vec, stream );
+    // Header, one block (count + raw bytes) and the end marker.
+    ASSERT_EQ( stream.str().size(), 16 + 8 + vec.size() * sizeof( int ) + 8 );
+
+    sc::vector<int> back{ 1, 2, 3 };
+    sc::deserialize( back, stream );
+    ASSERT_EQ( back, vec );
+}
+
+TEST(Serialize, StringsThroughBuffer)
+{
+    sc::vector<std::string> vec{ "", "a", std::string( 100, 'x' ), "hello" };
+
+    sc::vector<char> buffer;
+    sc::serialize( vec, buffer );
+
+    sc::vector<std::string> back;
+    sc::deserialize( back, buffer.data(), buffer.size() );
+    ASSERT_EQ( back.size(), vec.size() );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( back[i], vec[i] );
+
+    // Truncated input is reported, not read past the end.
+    ASSERT_THROW( sc::deserialize( back, buffer.data(), buffer.size() - 1 ), std::runtime_error );
+}
+
+TEST(Serialize, CustomSerializer)
+{
+    sc::vector<Named> vec{ { "ana", 10 }, { "bruno", -3 } };
+    std::stringstream stream;
+    sc::serialize( vec, stream );
+
+    sc::vector<Named> back;
+    sc::deserialize( back, stream );
+    ASSERT_EQ( back.size(), 2u );
+    ASSERT_EQ( back[1].name, "bruno" );
+    ASSERT_EQ( back[1].score, -3 );
+}
+
+TEST(Serialize, FileDescriptor)
+{
+    sc::vector<Sample> vec;
+    for ( auto i{0} ; i < 1000 ; ++i )
+        vec.push_back( Sample{ i, i / 2.0f } );
+    sc::vector<Sample> empty;
+
+    std::FILE * file = std::tmpfile();
+    ASSERT_NE( file, nullptr );
+    int fd = fileno( file );
+    sc::serialize( vec, fd );
+    sc::serialize( empty, fd );
+    lseek( fd, 0, SEEK_SET );
+
+    sc::vector<Sample> back;
+    sc::deserialize( back, fd );
+    ASSERT_EQ( back.size(), vec.size() );
+    ASSERT_EQ( back[999].id, 999 );
+    ASSERT_EQ( back[999].value, 499.5f );
+
+    sc::deserialize( back, fd );
+    ASSERT_TRUE( back.empty() );
+    std::fclose( file );
+}
+
+TEST(Serialize, StringsThroughFileDescriptor)
+{
+    // Two sequences back to back: the read-ahead of the first deserialize must not swallow the second one.
+    sc::vector<std::string> first;
+    for ( auto i{0} ; i < 5000 ; ++i )
+        first.push_back( std::to_string( i ) );
+    sc::vector<std::string> second{ "tail", std::string( 100000, 'y' ) };
+
+    std::FILE * file = std::tmpfile();
+    ASSERT_NE( file, nullptr );
+    int fd = fileno( file );
+    sc::serialize( first, fd );
+    sc::serialize( second, fd );
+    lseek( fd, 0, SEEK_SET );
+
+    sc::vector<std::string> back;
+    sc::deserialize( back, fd );
+    ASSERT_EQ( back, first );
+    sc::deserialize( back, fd );
+    ASSERT_EQ( back, second );
+    std::fclose( file );
+}
+
+TEST(Serialize, StringsAreBatchedIntoFewWrites)
+{
+    // Every message on a SOCK_SEQPACKET socket is one write call: count them on the other end.
+    sc::vector<std::string> vec;
+    for ( auto i{0} ; i < 10000 ; ++i )
+        vec.push_back( "string number " + std::to_string( i ) );
+
+    int fds[2];
+    ASSERT_EQ( socketpair( AF_UNIX, SOCK_SEQPACKET, 0, fds ), 0 );
+    sc::vector<char> received;
+    std::size_t messages = 0;
+    std::thread reader( [&]{
+        sc::vector<char> message;
+        message.resize_for_overwrite( 2 * sc::io::fd_buffer_size );
+        ssize_t got;
+        while ( ( got = recv( fds[1], message.data(), message.size(), 0 ) ) > 0 )
+        {
+            received.append( message.data(), got );
+            ++messages;
+        }
+    } );
+    sc::serialize( vec, fds[0] );
+    close( fds[0] );
+    reader.join();
+    close( fds[1] );
+
+    ASSERT_LE( messages, received.size() / sc::io::fd_buffer_size + 1 );
+    sc::vector<std::string> back;
+    sc::deserialize( back, received.data(), received.size() );
+    ASSERT_EQ( back, vec );
+}
+
+TEST(Serialize, RejectsOtherTypes)
+{
+    sc::vector<int> vec{ 1, 2, 3 };
+    std::stringstream stream;
+    sc::serialize( vec, stream );
+
+    sc::vector<double> wrong;
+    ASSERT_THROW( sc::deserialize( wrong, stream ), std::runtime_error );
+
+    std::stringstream garbage( "definitely not a vector" );
+    ASSERT_THROW( sc::deserialize( vec, garbage ), std::runtime_error );
+}
+
+TEST(Serialize, RejectsCorruptSizes)
+{
+    // Counts and lengths come from the input: a corrupt one must end the read, not allocate terabytes.
+    auto with_count = []( std::string encoded, std::uint64_t count ) {
+        encoded.resize( 16 );   // header only
+        encoded.append( reinterpret_cast<const char *>( &count ), sizeof( count ) );
+        encoded.append( "some bytes" );
+        return encoded;
+    };
+    sc::vector<char> ints_buffer;
+    sc::serialize( sc::vector<int>{ 1 }, ints_buffer );
+    const std::string ints_header( ints_buffer.data(), ints_buffer.size() );
+
+    sc::vector<int> ints;
+    for ( std::uint64_t count : { std::uint64_t(1) << 40, ~std::uint64_t(0) } )
+    {
+        std::stringstream stream( with_count( ints_header, count ) );
+        ASSERT_THROW( sc::deserialize( ints, stream ), std::runtime_error );
+        std::string bytes = with_count( ints_header, count );
+        ASSERT_THROW( sc::deserialize( ints, bytes.data(), bytes.size() ), std::runtime_error );
+        ASSERT_LT( ints.capacity() * sizeof( int ), 4u * 1024 * 1024 );
+    }
+
+    // A string whose length prefix is far beyond the input.
+    sc::vector<char> words_buffer;
+    sc::serialize( sc::vector<std::string>{ "a" }, words_buffer );
+    std::string words_header( words_buffer.data(), words_buffer.size() );
+    std::string bytes = with_count( words_header, 1 );
+    bytes.resize( 16 + 8 );
+    std::uint64_t length = std::uint64_t(1) << 40;
+    bytes.append( reinterpret_cast<const char *>( &length ), sizeof( length ) );
+    bytes.append( "abc" );
+    sc::vector<std::string> words;
+    ASSERT_THROW( sc::deserialize( words, bytes.data(), bytes.size() ), std::runtime_error );
+}
+
+TEST(Serialize, ChunkedStreaming)
+{
+    // Written in blocks of different sizes, read back in batches of at most 64 elements.
+    std::stringstream stream;
+    sc::io::ostream_sink out( stream );
+    {
+        sc::stream_writer<long, sc::io::ostream_sink> writer( out );
+        long next = 0;
+        for ( auto block : { 10, 100, 1, 500 } )
+        {
+            sc::vector<long> chunk;
+            for ( auto i{0} ; i < block ; ++i )
+                chunk.push_back( next++ );
+            writer.write( chunk );
+        }
+        // The destructor writes the end marker.
+    }
+
+    sc::io::istream_source in( stream );
+    sc::stream_reader<long, sc::io::istream_source> reader( in );
+    sc::vector<long> batch;
+    long expected = 0;
+    std::size_t batches = 0;
+    while ( true )
+    {
+        batch.clear();
+        std::size_t n = reader.read( batch, 64 );
+        if ( n == 0 )
+            break;
+        ASSERT_LE( n, 64u );
+        ASSERT_EQ( batch.size(), n );
+        for ( auto v : batch )
+            ASSERT_EQ( v, expected++ );
+        ++batches;
+    }
+    ASSERT_TRUE( reader.done() );
+    ASSERT_EQ( expected, 611 );
+    ASSERT_EQ( batches, 10u );
+}
+
+TEST(Serialize, WriterUnwoundByExceptionLeavesStreamUnterminated)
+{
+    // A producer that throws halfway must not leave a stream that reads as complete.
+    std::stringstream stream;
+    sc::io::ostream_sink out( stream );
+    try
+    {
+        sc::stream_writer<long, sc::io::ostream_sink> writer( out );
+        writer.write( sc::vector<long>{ 1, 2, 3 } );
+        throw std::runtime_error( "producer failed" );
+    }
+    catch ( const std::runtime_error & ) { }
+
+    sc::io::istream_source in( stream );
+    sc::stream_reader<long, sc::io::istream_source> reader( in );
+    sc::vector<long> batch;
+    ASSERT_EQ( reader.read( batch, 3 ), 3u );
+    ASSERT_EQ( batch, ( sc::vector<long>{ 1, 2, 3 } ) );
+    ASSERT_THROW( reader.read( batch, 64 ), std::runtime_error );
+    ASSERT_FALSE( reader.done() );
+}
@@ -0,0 +1,164 @@
+#include <cstdint>              // std::int32_t, std::uint8_t
+#include <limits>               // std::numeric_limits
+#include <random>               // std::mt19937
+#include <string>               // std::string
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/simd.h"    // header file for tested functions
+#include "../include/vector.h"  // header file for tested functions
+
+
+// ============================================================================
+// TESTING THE SIMD KERNELS AGAINST THE SCALAR ONES
+// ============================================================================
+// Every length up to a few registers, so that both the vector body and the
+// scalar tail are exercised.
+
+template < typename T >
+class Simd : public ::testing::Test { };
+
+using SimdTypes = ::testing::Types< std::int32_t, std::uint8_t, float, double >;
+TYPED_TEST_SUITE( Simd, SimdTypes );
+
+template < typename T >
+sc::vector<T> random_values( std::size_t n, std::mt19937 & gen )
+{
+    // Poucos valores distintos, para que find e count encontrem repetições.
+    std::uniform_int_distribution<int> dist( 0, 20 );
+    sc::vector<T> vec;
+    for ( std::size_t i = 0 ; i < n ; ++i )
+        vec.push_back( static_cast<T>( dist( gen ) ) );
+    return vec;
+}
+
+// Checks one kernel table (one instruction set, or the dispatcher) against sc::simd::scalar.
+template < typename T, typename Kernels >
+void check_against_scalar( Kernels kernels )
+{
+    std::mt19937 gen( 42 );
+    for ( std::size_t n = 0 ; n < 100 ; ++n )
+    {
+        auto a = random_values<T>( n, gen );
+        auto b = a;
+        const T * p = a.data();
+
+        ASSERT_TRUE( kernels.equal( p, b.data(), n ) );
+        if ( n > 0 )
+        {
+            b[n - 1] = static_cast<T>( 99 );
+            ASSERT_FALSE( kernels.equal( p, b.data(), n ) );
+        }
+        for ( int v : { 0, 7, 20, 99 } )
+        {
+            ASSERT_EQ( kernels.find( p, n, static_cast<T>( v ) ), sc::simd::scalar::find( p, n, static_cast<T>( v ) ) );
+            ASSERT_EQ( kernels.count( p, n, static_cast<T>( v ) ), sc::simd::scalar::count( p, n, static_cast<T>( v ) ) );
+        }
+        ASSERT_EQ( kernels.sum( p, n ), sc::simd::scalar::sum( p, n ) );   // small integers: exact even for floats
+        if ( n > 0 )
+        {
+            ASSERT_EQ( kernels.min( p, n ), sc::simd::scalar::min( p, n ) );
+            ASSERT_EQ( kernels.max( p, n ), sc::simd::scalar::max( p, n ) );
+        }
+    }
+}
+
+template < typename T >
+struct Dispatched {
+    bool equal( const T * a, const T * b, std::size_t n ) { return sc::simd::equal( a, b, n ); }
+    std::size_t find( const T * p, std::size_t n, T v ) { return sc::simd::find( p, n, v ); }
+    std::size_t count( const T * p, std::size_t n, T v ) { return sc::simd::count( p, n, v ); }
+    T min( const T * p, std::size_t n ) { return sc::simd::min( p, n ); }
+    T max( const T * p, std::size_t n ) { return sc::simd::max( p, n ); }
+    sc::simd::sum_type<T> sum( const T * p, std::size_t n ) { return sc::simd::sum( p, n ); }
+};
+
+#if SC_SIMD_X86
+#define KERNEL_TABLE( name, isa )                                                                                        \
+    template < typename T >                                                                                               \
+    struct name {                                                                                                         \
+        using K = sc::simd::detail::isa##_ops<T>;                                                                         \
+        bool equal( const T * a, const T * b, std::size_t n ) { return sc::simd::isa::equal<K>( a, b, n ); }             \
+        std::size_t find( const T * p, std::size_t n, T v ) { return sc::simd::isa::find<K>( p, n, v ); }                \
+        std::size_t count( const T * p, std::size_t n, T v ) { return sc::simd::isa::count<K>( p, n, v ); }              \
+        T min( const T * p, std::size_t n ) { return sc::simd::isa::min<K>( p, n ); }                                    \
+        T max( const T * p, std::size_t n ) { return sc::simd::isa::max<K>( p, n ); }                                    \
+        sc::simd::sum_type<T> sum( const T * p, std::size_t n ) { return sc::simd::isa::sum<K>( p, n ); }                \
+    };
+
+KERNEL_TABLE( Sse2, sse2 )
+KERNEL_TABLE( Avx2, avx2 )
+
+TYPED_TEST(Simd, Sse2MatchesScalar)
+{
+    check_against_scalar<TypeParam>( Sse2<TypeParam>() );
+}
+
+TYPED_TEST(Simd, Avx2MatchesScalar)
+{
+    if ( sc::simd::active_isa() != sc::simd::isa::avx2 )
+        GTEST_SKIP() << "CPU without AVX2";
+    check_against_scalar<TypeParam>( Avx2<TypeParam>() );
+}
+#endif
+
+TYPED_TEST(Simd, DispatchMatchesScalar)
+{
+    check_against_scalar<TypeParam>( Dispatched<TypeParam>() );
+}
+
+TEST(Simd, FloatEqualityFollowsOperator)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    sc::vector<float> a( { 1, 2, 3, 4, 5, 6, 7, 8, nan } );
+    sc::vector<float> b( { 1, 2, 3, 4, 5, 6, 7, 8, nan } );
+    ASSERT_NE( a, b );           // NaN != NaN
+
+    sc::vector<float> c( { 0.0f, 1, 2, 3, 4, 5, 6, 7 } );
+    sc::vector<float> d( { -0.0f, 1, 2, 3, 4, 5, 6, 7 } );
+    ASSERT_EQ( c, d );           // 0.0 == -0.0
+}
+
+TEST(Simd, OtherIntegersCompareBytewise)
+{
+    sc::vector<short> a( { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 } );
+    sc::vector<short> b( a );
+    ASSERT_EQ( a, b );
+    b[16] = 0;
+    ASSERT_NE( a, b );
+}
+
+TEST(Simd, VectorHelpers)
+{
+    sc::vector<int> vec;
+    for ( int i = 0 ; i < 1000 ; ++i )
+        vec.push_back( i % 100 - 50 );
+
+    ASSERT_EQ( sc::find( vec, 10 ) - vec.cbegin(), 60 );
+    ASSERT_EQ( sc::find( vec, 1000 ), vec.cend() );
+    ASSERT_EQ( sc::count( vec, 0 ), 10 );
+    ASSERT_EQ( sc::min( vec ), -50 );
+    ASSERT_EQ( sc::max( vec ), 49 );
+    ASSERT_EQ( sc::sum( vec ), -500 );
+
+    sc::vector<int> empty;
+    ASSERT_THROW( sc::min( empty ), std::out_of_range );
+
+    // Tipos não aritméticos usam a versão escalar.
+    sc::vector<std::string> words( { "a", "b", "a" } );
+    ASSERT_EQ( sc::count( words, std::string( "a" ) ), 2 );
+    ASSERT_EQ( sc::find( words, std::string( "b" ) ) - words.cbegin(), 1 );
+}
+
+TEST(Simd, LargeSums)
+{
+    // uint8_t e int32_t são acumulados em 64 bits, sem estourar.
+    sc::vector<std::uint8_t> bytes;
+    sc::vector<std::int32_t> ints;
+    for ( int i = 0 ; i < 100000 ; ++i )
+    {
+        bytes.push_back( 255 );
+        ints.push_back( 2000000000 );
+    }
+    ASSERT_EQ( sc::sum( bytes ), 255ull * 100000 );
+    ASSERT_EQ( sc::sum( ints ), 2000000000ll * 100000 );
+}
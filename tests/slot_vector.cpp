@@ -0,0 +1,150 @@
+#include <algorithm>            // std::find
+#include <random>               // std::mt19937
+#include <stdexcept>            // std::out_of_range, std::runtime_error
+#include <string>               // std::string
+#include <unordered_map>        // std::unordered_map
+#include <vector>               // std::vector
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/slot_vector.h"  // header file for tested functions
+
+
+// ============================================================================
+// TESTING SLOT_VECTOR
+// ============================================================================
+
+TEST(SlotVector, HandlesSurviveEraseAndGrowth)
+{
+    sc::slot_vector<std::string> vec;
+    auto a = vec.insert( "a" );
+    auto b = vec.insert( "b" );
+    auto c = vec.emplace( 3, 'c' );
+    ASSERT_EQ( vec.size(), 3u );
+    ASSERT_EQ( vec[c], "ccc" );
+
+    // Erasing from the middle moves the last element into the hole.
+    ASSERT_TRUE( vec.erase( a ) );
+    ASSERT_EQ( vec.size(), 2u );
+    ASSERT_EQ( vec.values()[0], "ccc" );
+    ASSERT_EQ( vec[b], "b" );
+    ASSERT_EQ( vec[c], "ccc" );
+
+    // Growth reallocates the dense storage but not the handles.
+    std::vector<sc::slot_handle> more;
+    for ( auto i{0} ; i < 1000 ; ++i )
+        more.push_back( vec.insert( std::to_string( i ) ) );
+    ASSERT_EQ( vec.at( b ), "b" );
+    ASSERT_EQ( vec.at( more[500] ), "500" );
+}
+
+TEST(SlotVector, StaleHandlesAreRejected)
+{
+    sc::slot_vector<int> vec;
+    auto h = vec.insert( 1 );
+    ASSERT_TRUE( vec.erase( h ) );
+    ASSERT_FALSE( vec.erase( h ) );
+    ASSERT_FALSE( vec.contains( h ) );
+    ASSERT_EQ( vec.get( h ), nullptr );
+    ASSERT_THROW( vec.at( h ), std::out_of_range );
+
+    // The free slot is reused with a new generation.
+    auto reused = vec.insert( 2 );
+    ASSERT_EQ( reused.index, h.index );
+    ASSERT_NE( reused, h );
+    ASSERT_FALSE( vec.contains( h ) );
+    ASSERT_EQ( *vec.get( reused ), 2 );
+
+    ASSERT_FALSE( vec.contains( sc::slot_handle{} ) );
+    ASSERT_FALSE( vec.contains( sc::slot_handle{ 42, 0 } ) );
+
+    vec.clear();
+    ASSERT_TRUE( vec.empty() );
+    ASSERT_FALSE( vec.contains( reused ) );
+}
+
+TEST(SlotVector, ForeignAndForgedHandlesAreRejected)
+{
+    sc::slot_vector<int> other;
+    other.insert( 1 );
+    other.erase( other.insert( 2 ) );
+    auto foreign = other.insert( 3 );   // slot 1, second generation
+
+    sc::slot_vector<int> vec;
+    auto h = vec.insert( 1 );
+    vec.insert( 2 );
+    vec.erase( h );
+
+    // A handle whose generation happens to match a free slot.
+    sc::slot_handle forged{ h.index, h.generation + 1 };
+    ASSERT_FALSE( vec.contains( forged ) );
+    ASSERT_EQ( vec.get( forged ), nullptr );
+    ASSERT_THROW( vec.at( forged ), std::out_of_range );
+    ASSERT_FALSE( vec.erase( forged ) );
+    ASSERT_EQ( vec.size(), 1u );
+
+    ASSERT_FALSE( vec.contains( foreign ) );
+    ASSERT_FALSE( vec.erase( foreign ) );
+
+    // The free list is intact: the slot is reused once and a new one is added after it.
+    auto reused = vec.insert( 4 );
+    auto fresh = vec.insert( 5 );
+    ASSERT_EQ( reused.index, h.index );
+    ASSERT_NE( fresh.index, h.index );
+    ASSERT_EQ( vec.size(), 3u );
+    ASSERT_EQ( vec[reused], 4 );
+    ASSERT_EQ( vec[fresh], 5 );
+}
+
+TEST(SlotVector, DenseIterationMatchesReference)
+{
+    sc::slot_vector<long> vec;
+    std::unordered_map<long, sc::slot_handle> live;
+    std::mt19937 gen( 3 );
+    long next{0};
+
+    for ( auto round{0} ; round < 2000 ; ++round )
+    {
+        if ( live.empty() or gen() % 3 != 0 )
+        {
+            live[next] = vec.insert( next );
+            ++next;
+        }
+        else
+        {
+            auto it = std::next( live.begin(), gen() % live.size() );
+            ASSERT_TRUE( vec.erase( it->second ) );
+            live.erase( it );
+        }
+    }
+
+    ASSERT_EQ( vec.size(), live.size() );
+    long sum{0}, expected{0};
+    for ( auto value : vec )
+        sum += value;
+    for ( const auto & [value, h] : live )
+    {
+        expected += value;
+        ASSERT_EQ( vec[h], value );
+    }
+    ASSERT_EQ( sum, expected );
+
+    // Every dense position maps back to the handle of its element.
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( live.at( vec.data()[i] ), vec.handle_at( i ) );
+}
+
+TEST(SlotVector, ThrowingInsertReleasesSlot)
+{
+    struct Picky {
+        int value;
+        explicit Picky( int v ) : value( v ) { if ( v < 0 ) throw std::runtime_error( "negative" ); }
+    };
+    sc::slot_vector<Picky> vec;
+    auto ok = vec.emplace( 1 );
+    ASSERT_THROW( vec.emplace( -1 ), std::runtime_error );
+    ASSERT_EQ( vec.size(), 1u );
+    auto next = vec.emplace( 2 );
+    ASSERT_EQ( vec[ok].value, 1 );
+    ASSERT_EQ( vec[next].value, 2 );
+    ASSERT_EQ( vec.handle_at( 1 ), next );
+}
@@ -0,0 +1,207 @@
+#include <iterator>             // std::begin(), std::end()
+#include <memory_resource>      // std::pmr::monotonic_buffer_resource
+#include <string>               // std::string
+#include <type_traits>          // std::is_nothrow_move_constructible
+#include <utility>              // std::declval
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/small_vector.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING THE INLINE BUFFER OF SMALL_VECTOR
+// ============================================================================
+// The container behaviour is covered by the IntVector suite in main.cpp,
+// which also runs against small_vector. These tests check where the
+// elements live: an inline capacity smaller than the vectors used below
+// and one larger.
+
+template < typename V >
+class SmallVector : public ::testing::Test { };
+
+using SmallVectorTypes = ::testing::Types< sc::small_vector<int, 2>, sc::small_vector<int, 16> >;
+TYPED_TEST_SUITE( SmallVector, SmallVectorTypes );
+
+template < typename V >
+bool uses_inline_buffer( const V & vec )
+{
+    auto p = reinterpret_cast<const char*>( vec.data() );
+    auto self = reinterpret_cast<const char*>( &vec );
+    return p >= self and p < self + sizeof( vec );
+}
+
+TYPED_TEST(SmallVector, DefaultConstructor)
+{
+    TypeParam vec;
+
+    EXPECT_EQ( vec.size(), 0 );
+    EXPECT_EQ( vec.capacity(), TypeParam::inline_capacity );
+    EXPECT_TRUE( vec.empty() );
+    EXPECT_TRUE( vec.is_small() );
+    EXPECT_TRUE( uses_inline_buffer( vec ) );
+}
+
+TYPED_TEST(SmallVector, ListConstructor)
+{
+    TypeParam vec{ 1, 2, 3, 4, 5 };
+    ASSERT_EQ( vec.size(), 5 );
+    EXPECT_FALSE( vec.empty() );
+    EXPECT_EQ( vec.is_small(), 5 <= TypeParam::inline_capacity );
+
+    for( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( i+1, vec[i] );
+}
+
+TYPED_TEST(SmallVector, Reserve)
+{
+    TypeParam vec { 1, 2, 3, 4, 5 };
+
+    vec.reserve( 40 );
+    ASSERT_GE( vec.capacity(), 40u );
+    ASSERT_FALSE( vec.is_small() );
+
+    auto i{0};
+    for( const auto & e : vec )
+        ASSERT_EQ( e, ++i );
+}
+
+TYPED_TEST(SmallVector, Swap)
+{
+    TypeParam small { 1 };
+    TypeParam big;
+    for ( auto i{0} ; i < 40 ; ++i )
+        big.push_back( i );
+
+    small.swap( big );
+    ASSERT_EQ( small.size(), 40 );
+    ASSERT_EQ( big , ( TypeParam{ 1 } ) );
+    for ( auto i{0u} ; i < small.size() ; ++i )
+        ASSERT_EQ( small[i], i );
+}
+
+TEST(SmallVectorString, SwapKeepsInlineBuffers)
+{
+    using small = sc::small_vector<std::string, 4>;
+
+    // Both inline: the elements are swapped in place, nothing goes to the heap.
+    small a{ "a", "b" }, b{ "c" };
+    a.swap( b );
+    ASSERT_TRUE( a.is_small() );
+    ASSERT_TRUE( b.is_small() );
+    ASSERT_EQ( a, ( small{ "c" } ) );
+    ASSERT_EQ( b, ( small{ "a", "b" } ) );
+
+    // One inline, one on the heap: the heap block changes hands and the inline
+    // elements move to the other inline buffer.
+    small heap{ "1", "2", "3", "4", "5" };
+    auto block = heap.data();
+    a.swap( heap );
+    ASSERT_EQ( a.data(), block );
+    ASSERT_TRUE( heap.is_small() );
+    ASSERT_TRUE( uses_inline_buffer( heap ) );
+    ASSERT_EQ( heap, ( small{ "c" } ) );
+    ASSERT_EQ( a, ( small{ "1", "2", "3", "4", "5" } ) );
+    swap( a, heap );
+    ASSERT_TRUE( a.is_small() );
+    ASSERT_EQ( heap.data(), block );
+    ASSERT_EQ( a, ( small{ "c" } ) );
+}
+
+TEST(SmallVectorString, MovedFromReturnsToInlineBuffer)
+{
+    using small = sc::small_vector<std::string, 4>;
+    small heap{ "1", "2", "3", "4", "5" };
+    small target( std::move( heap ) );
+    ASSERT_EQ( target.size(), 5 );
+    ASSERT_TRUE( heap.is_small() );
+    ASSERT_EQ( heap.capacity(), small::inline_capacity );
+    heap.push_back( "x" );
+    ASSERT_TRUE( heap.is_small() );
+
+    small other{ "6", "7", "8", "9", "10" };
+    target = std::move( other );
+    ASSERT_TRUE( other.is_small() );
+    ASSERT_EQ( other.capacity(), small::inline_capacity );
+
+    // Into a plain vector as well.
+    sc::vector<std::string> plain( std::move( target ) );
+    ASSERT_EQ( plain.size(), 5 );
+    ASSERT_TRUE( target.is_small() );
+    ASSERT_TRUE( uses_inline_buffer( target ) );
+}
+
+TEST(SmallVectorString, SpillsAndDestroys)
+{
+    sc::small_vector<std::string, 4> vec;
+
+    for ( auto i{0} ; i < 4 ; ++i )
+        vec.push_back( std::string( 50, 'a'+i ) );
+    ASSERT_TRUE( vec.is_small() );
+    ASSERT_TRUE( uses_inline_buffer( vec ) );
+
+    vec.push_back( std::string( 50, 'e' ) );
+    ASSERT_FALSE( vec.is_small() );
+    for ( auto i{0u} ; i < vec.size() ; ++i )
+        ASSERT_EQ( vec[i], std::string( 50, 'a'+i ) );
+
+    // Moving a vector that is still inline moves the elements one by one.
+    sc::small_vector<std::string, 4> inl{ "x", "y" };
+    sc::small_vector<std::string, 4> moved( std::move( inl ) );
+    ASSERT_TRUE( moved.is_small() );
+    ASSERT_EQ( moved , ( sc::small_vector<std::string, 4>{ "x", "y" } ) );
+
+    // Into a plain vector as well, which then needs a block of its own.
+    sc::vector<std::string> plain( std::move( moved ) );
+    ASSERT_EQ( plain.size(), 2 );
+    ASSERT_EQ( plain[1], "y" );
+
+    sc::small_vector<std::string, 4> more{ "z" };
+    plain = std::move( more );
+    ASSERT_EQ( plain, ( sc::vector<std::string>{ "z" } ) );
+
+    // Read-only access as a vector, e.g. to copy it or search it.
+    sc::small_vector<std::string, 4> words{ "p", "q" };
+    sc::vector<std::string> copy( words.as_vector() );
+    ASSERT_EQ( copy, words.as_vector() );
+    ASSERT_EQ( sc::find( words.as_vector(), std::string( "q" ) ), words.cbegin() + 1 );
+}
+
+TEST(SmallVectorString, MoveAndSwapDoNotAllocateInNoexcept)
+{
+    using small = sc::small_vector<std::string, 4>;
+    // Moving a small_vector never allocates (an inline source fits the inline buffer of the target).
+    static_assert( std::is_nothrow_move_constructible<small>::value );
+    static_assert( std::is_nothrow_move_assignable<small>::value );
+    // Swapping never allocates either: inline elements only move between inline buffers.
+    static_assert( noexcept( std::declval<small&>().swap( std::declval<small&>() ) ) );
+    static_assert( std::is_nothrow_move_constructible< sc::vector<std::string> >::value );
+    // Nor can it be moved or swapped as a plain vector, whose move and swap are noexcept.
+    static_assert( not std::is_convertible< small&, sc::vector<std::string>& >::value );
+    static_assert( not std::is_convertible< small&&, sc::vector<std::string>&& >::value );
+
+    // A target that went to the heap and shrank returns to its buffer to receive an inline source.
+    small target;
+    for ( auto i{0} ; i < 10 ; ++i )
+        target.push_back( std::string( 50, 'a'+i ) );
+    target.resize( 2 );
+    target.shrink_to_fit();
+    ASSERT_FALSE( target.is_small() );
+    ASSERT_EQ( target.capacity(), 2 );
+
+    small source{ "x", "y", "z" };
+    target = std::move( source );
+    ASSERT_TRUE( target.is_small() );
+    ASSERT_EQ( target , ( small{ "x", "y", "z" } ) );
+}
+
+TEST(SmallVectorString, CopySelectsAllocator)
+{
+    // polymorphic_allocator does not follow a copy: the copy uses the default resource.
+    using pmr_small = sc::small_vector<int, 2, std::pmr::polymorphic_allocator<int>>;
+    std::pmr::monotonic_buffer_resource resource;
+    pmr_small vec( { 1, 2, 3, 4, 5 }, &resource );
+    pmr_small copy( vec );
+    ASSERT_EQ( copy, vec );
+    EXPECT_EQ( vec.get_allocator().resource(), &resource );
+    EXPECT_EQ( copy.get_allocator().resource(), std::pmr::get_default_resource() );
+}
@@ -0,0 +1,172 @@
+#include <memory_resource>      // std::pmr::memory_resource
+#include <numeric>              // std::accumulate
+#include <stdexcept>            // std::out_of_range, std::runtime_error
+#include <string>               // std::string
+#include <tuple>                // std::get, std::make_tuple
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/soa_vector.h"   // header file for tested functions
+
+
+// ============================================================================
+// TESTING SOA_VECTOR
+// ============================================================================
+
+TEST(SoaVector, ColumnsShareSizeAndCapacity)
+{
+    sc::soa_vector<float, double, int> vec;
+    ASSERT_TRUE( vec.empty() );
+
+    for ( auto i{0} ; i < 1000 ; ++i )
+        vec.push_back( std::make_tuple( i * 1.0f, i * 0.5, -i ) );
+    ASSERT_EQ( vec.size(), 1000u );
+    ASSERT_GE( vec.capacity(), 1000u );
+
+    auto xs = vec.column<0>();
+    auto ids = vec.column<2>();
+    ASSERT_EQ( xs.size(), 1000u );
+    ASSERT_EQ( xs.data(), vec.data<0>() );
+    ASSERT_EQ( ids[999], -999 );
+    ASSERT_EQ( std::accumulate( xs.begin(), xs.end(), 0.0f ), 999 * 1000 / 2.0f );
+}
+
+TEST(SoaVector, RowProxies)
+{
+    sc::soa_vector<int, std::string> vec;
+    vec.emplace_back( 1, "one" );
+    vec.emplace_back( 2, "two" );
+
+    auto [id, name] = vec[1];
+    ASSERT_EQ( id, 2 );
+    ASSERT_EQ( name, "two" );
+
+    // The row is a tuple of references: writes go to the columns.
+    name = "dois";
+    std::get<0>( vec[0] ) = 10;
+    ASSERT_EQ( vec.column<1>()[1], "dois" );
+    ASSERT_EQ( vec.column<0>()[0], 10 );
+
+    vec[0] = std::make_tuple( 5, std::string( "five" ) );
+    ASSERT_EQ( std::get<1>( vec.front() ), "five" );
+    ASSERT_EQ( std::get<0>( vec.back() ), 2 );
+    ASSERT_THROW( vec.at( 2 ), std::out_of_range );
+
+    const auto & cvec = vec;
+    ASSERT_EQ( std::get<1>( cvec.at( 1 ) ), "dois" );
+}
+
+TEST(SoaVector, GrowthKeepsRowsAndAliasing)
+{
+    sc::soa_vector<std::string, long> vec;
+    vec.reserve( 4 );
+    ASSERT_EQ( vec.capacity(), 4u );
+    for ( auto i{0} ; i < 4 ; ++i )
+        vec.emplace_back( std::string( 30, 'a' + i ), i );
+
+    // Full: the new row refers to a row that moves during the reallocation.
+    auto [s, n] = vec[0];
+    vec.emplace_back( s, n );
+    ASSERT_EQ( vec.size(), 5u );
+    ASSERT_EQ( std::get<0>( vec[4] ), std::string( 30, 'a' ) );
+    ASSERT_EQ( std::get<0>( vec[3] ), std::string( 30, 'd' ) );
+
+    vec.pop_back();
+    vec.shrink_to_fit();
+    ASSERT_EQ( vec.capacity(), 4u );
+
+    vec.clear();
+    ASSERT_TRUE( vec.empty() );
+    ASSERT_EQ( vec.capacity(), 4u );
+}
+
+TEST(SoaVector, CopyMoveSwap)
+{
+    sc::soa_vector<int, std::string> vec;
+    for ( auto i{0} ; i < 10 ; ++i )
+        vec.emplace_back( i, std::to_string( i ) );
+
+    sc::soa_vector<int, std::string> copy( vec );
+    ASSERT_EQ( copy.size(), 10u );
+    ASSERT_NE( copy.data<0>(), vec.data<0>() );
+    ASSERT_EQ( std::get<1>( copy[7] ), "7" );
+
+    auto storage = vec.data<1>();
+    sc::soa_vector<int, std::string> moved( std::move( vec ) );
+    ASSERT_EQ( moved.data<1>(), storage );
+    ASSERT_TRUE( vec.empty() );
+
+    sc::soa_vector<int, std::string> other;
+    other.emplace_back( 42, "x" );
+    other = copy;
+    ASSERT_EQ( other.size(), 10u );
+    swap( other, moved );
+    ASSERT_EQ( moved.size(), 10u );
+}
+
+TEST(SoaVector, ThrowingFieldLeavesRowUnbuilt)
+{
+    struct Picky {
+        std::string value;
+        explicit Picky( const char * v ) : value( v ) { if ( value.empty() ) throw std::runtime_error( "empty" ); }
+    };
+    sc::soa_vector<std::string, Picky> vec;
+    vec.emplace_back( "a", "ok" );
+    ASSERT_THROW( vec.emplace_back( "b", "" ), std::runtime_error );
+    ASSERT_EQ( vec.size(), 1u );
+    ASSERT_EQ( std::get<0>( vec[0] ), "a" );
+}
+
+// Resource that counts bytes in flight, to catch a block freed through the wrong resource.
+class TrackingResource : public std::pmr::memory_resource
+{
+    public:
+        long in_use{0};
+
+    protected:
+        void * do_allocate( std::size_t bytes, std::size_t alignment ) override
+        {
+            in_use += bytes;
+            return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+        }
+        void do_deallocate( void * p, std::size_t bytes, std::size_t alignment ) override
+        {
+            in_use -= bytes;
+            std::pmr::new_delete_resource()->deallocate( p, bytes, alignment );
+        }
+        bool do_is_equal( const std::pmr::memory_resource & other ) const noexcept override
+        { return this == &other; }
+};
+
+TEST(SoaVector, AssignmentKeepsNonPropagatingAllocator)
+{
+    using pmr_soa = sc::basic_soa_vector<sc::growth::default_policy, std::pmr::polymorphic_allocator<char>, int, std::string>;
+    TrackingResource first, second;
+    {
+        pmr_soa vec( &first );
+        for ( auto i{0} ; i < 10 ; ++i )
+            vec.push_back( { i, std::string( 40, 'a' + i ) } );
+        pmr_soa other( &second );
+        other.push_back( { -1, "z" } );
+
+        other = vec;
+        ASSERT_EQ( other.size(), 10u );
+        ASSERT_EQ( std::get<1>( other[9] ), std::string( 40, 'j' ) );
+        EXPECT_EQ( other.get_allocator().resource(), &second );
+
+        pmr_soa moved( &second );
+        moved = std::move( vec );
+        ASSERT_EQ( moved.size(), 10u );
+        ASSERT_EQ( std::get<0>( moved[3] ), 3 );
+        EXPECT_TRUE( vec.empty() );
+        EXPECT_EQ( moved.get_allocator().resource(), &second );
+
+        // Same resource: the allocators stay where they are and the columns change hands.
+        auto column = moved.data<0>();
+        other.swap( moved );
+        EXPECT_EQ( other.data<0>(), column );
+        EXPECT_EQ( other.get_allocator().resource(), &second );
+        EXPECT_EQ( vec.get_allocator().resource(), &first );
+    }
+    EXPECT_EQ( first.in_use, 0 );
+    EXPECT_EQ( second.in_use, 0 );
+}
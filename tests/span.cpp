@@ -0,0 +1,116 @@
+#include <numeric>              // std::accumulate
+#include <stdexcept>            // std::out_of_range
+#include <string>               // std::string
+#include <thread>               // std::thread
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/span.h"    // header file for tested functions
+
+
+// ============================================================================
+// TESTING SPAN
+// ============================================================================
+
+TEST(Span, ViewsVectorWithoutCopying)
+{
+    sc::vector<int> vec{ 1, 2, 3, 4, 5 };
+    sc::span view( vec );
+    ASSERT_EQ( view.data(), vec.data() );
+    ASSERT_EQ( view.size(), 5u );
+    ASSERT_EQ( view.size_bytes(), 5 * sizeof( int ) );
+
+    // Writes go to the vector.
+    view[0] = 10;
+    ASSERT_EQ( vec[0], 10 );
+    ASSERT_EQ( view.front(), 10 );
+    ASSERT_EQ( view.back(), 5 );
+    ASSERT_EQ( view.at( 4 ), 5 );
+    ASSERT_THROW( view.at( 5 ), std::out_of_range );
+
+    const sc::vector<int> & cvec = vec;
+    sc::vector_view<int> readonly = cvec;
+    ASSERT_EQ( readonly.data(), vec.data() );
+    sc::span<const int> converted = view;
+    ASSERT_EQ( converted.size(), 5u );
+}
+
+TEST(Span, PointerConstructors)
+{
+    int array[] = { 1, 2, 3, 4 };
+    // A literal 0 is a count, never a pointer.
+    sc::span<int> none( array, 0 );
+    ASSERT_TRUE( none.empty() );
+    ASSERT_EQ( none.data(), array );
+
+    sc::span<int> counted( array, 3 );
+    ASSERT_EQ( counted.size(), 3u );
+    sc::span<int> range( array + 1, array + 4 );
+    ASSERT_EQ( range.size(), 3u );
+    ASSERT_EQ( range.front(), 2 );
+    sc::span<const int> readonly( array, array + 2 );
+    ASSERT_EQ( readonly.back(), 2 );
+}
+
+TEST(Span, Slicing)
+{
+    int array[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    sc::span<int> all( array );
+
+    auto head = all.first( 3 );
+    ASSERT_EQ( head.size(), 3u );
+    ASSERT_EQ( head.back(), 2 );
+
+    auto tail = all.last( 2 );
+    ASSERT_EQ( tail.data(), array + 8 );
+
+    auto middle = all.subspan( 4, 3 );
+    ASSERT_EQ( middle.front(), 4 );
+    ASSERT_EQ( middle.size(), 3u );
+    ASSERT_EQ( all.subspan( 7 ).size(), 3u );
+    ASSERT_TRUE( all.subspan( 10 ).empty() );
+
+    ASSERT_THROW( all.first( 11 ), std::out_of_range );
+    ASSERT_THROW( all.subspan( 11 ), std::out_of_range );
+    ASSERT_THROW( all.subspan( 5, 6 ), std::out_of_range );
+
+    int sum = 0;
+    for ( auto v : middle )
+        sum += v;
+    ASSERT_EQ( sum, 4 + 5 + 6 );
+}
+
+TEST(Span, CopyIntoVector)
+{
+    sc::vector<std::string> names{ "a", "b", "c", "d" };
+    sc::vector_view<std::string> view( names );
+    auto middle = view.subspan( 1, 2 );
+
+    // The range constructor does one allocation and copies the slice.
+    sc::vector<std::string> copy( middle.begin(), middle.end() );
+    ASSERT_EQ( copy.size(), 2u );
+    ASSERT_EQ( copy.capacity(), 2u );
+    ASSERT_EQ( copy[0], "b" );
+    ASSERT_EQ( copy[1], "c" );
+}
+
+TEST(Span, SlicesHandedToWorkers)
+{
+    sc::vector<long> vec;
+    for ( auto i{0} ; i < 100000 ; ++i )
+        vec.push_back( i );
+
+    sc::span<long> all( vec );
+    long sums[4] = {};
+    std::thread workers[4];
+    auto quarter = all.size() / 4;
+    for ( auto w{0} ; w < 4 ; ++w )
+    {
+        auto slice = w == 3 ? all.subspan( w * quarter ) : all.subspan( w * quarter, quarter );
+        workers[w] = std::thread( [slice, &sums, w] {
+            sums[w] = std::accumulate( slice.begin(), slice.end(), 0L );
+        } );
+    }
+    for ( auto & t : workers )
+        t.join();
+    ASSERT_EQ( sums[0] + sums[1] + sums[2] + sums[3], 99999L * 100000L / 2 );
+}
@@ -0,0 +1,151 @@
+#include <memory>               // std::allocator
+#include <string>               // std::string
+
+#include "gtest/gtest.h"        // gtest lib
+#include "../include/vector.h"  // header file for tested functions
+
+
+// ============================================================================
+// TESTING INSTRUMENTATION COUNTERS
+// ============================================================================
+
+template < typename T >
+using counted_vector = sc::vector<T, std::allocator<T>, sc::stats::counted<sc::growth::doubling> >;
+
+// Each test uses its own element type, so it owns its counters.
+struct GrowthSample { long value; };
+struct ShiftSample { int value; };
+struct CycleSample { int value; };
+struct AssignSample { int value; };
+
+TEST(Stats, CountsGrowth)
+{
+    auto & c = sc::stats::counters_for< counted_vector<GrowthSample> >();
+    {
+        counted_vector<GrowthSample> vec;
+        for ( long i{0} ; i < 100 ; ++i )
+            vec.push_back( GrowthSample{ i } );
+        ASSERT_EQ( vec.capacity(), 128u );
+    }
+    // Doubling from 1: 1, 2, 4, ..., 128.
+    EXPECT_EQ( c.reallocations.load(), 8u );
+    EXPECT_EQ( c.bytes_allocated.load(), 255 * sizeof( GrowthSample ) );
+    EXPECT_EQ( c.bytes_relocated.load(), 127 * sizeof( GrowthSample ) );
+    EXPECT_EQ( c.peak_capacity.load(), 128u );
+    EXPECT_EQ( c.wasted_bytes.load(), 28 * sizeof( GrowthSample ) );
+
+    // reserve() up front: a single allocation and nothing relocated.
+    c.reset();
+    {
+        counted_vector<GrowthSample> vec;
+        vec.reserve( 100 );
+        for ( long i{0} ; i < 100 ; ++i )
+            vec.push_back( GrowthSample{ i } );
+    }
+    EXPECT_EQ( c.reallocations.load(), 1u );
+    EXPECT_EQ( c.bytes_relocated.load(), 0u );
+    EXPECT_EQ( c.wasted_bytes.load(), 0u );
+}
+
+TEST(Stats, CountsBlocksReplacedByAssignment)
+{
+    auto & c = sc::stats::counters_for< counted_vector<AssignSample> >();
+    counted_vector<AssignSample> vec;
+    vec.assign( 10, AssignSample{ 1 } );
+    EXPECT_EQ( c.reallocations.load(), 1u );
+
+    counted_vector<AssignSample> bigger;
+    bigger.assign( 20, AssignSample{ 2 } );
+    vec = bigger;                                  // copy assignment into a larger block
+    EXPECT_EQ( c.reallocations.load(), 3u );
+    vec.assign( { AssignSample{ 3 } } );          // fits: no new block
+    EXPECT_EQ( c.reallocations.load(), 3u );
+
+    // Shrinking moves the elements to a new block too.
+    vec.shrink_to_fit();
+    EXPECT_EQ( c.reallocations.load(), 4u );
+    EXPECT_EQ( c.bytes_relocated.load(), sizeof( AssignSample ) );
+}
+
+TEST(Stats, CountsShifts)
+{
+    auto & c = sc::stats::counters_for< counted_vector<ShiftSample> >();
+    counted_vector<ShiftSample> vec;
+    vec.reserve( 16 );
+    for ( auto i{0} ; i < 10 ; ++i )
+        vec.push_back( ShiftSample{ i } );
+    ASSERT_EQ( c.elements_shifted.load(), 0u );
+
+    vec.push_front( ShiftSample{ -1 } );                  // shifts 10
+    vec.insert( vec.cbegin() + 5, ShiftSample{ 0 } );     // shifts 6
+    vec.erase( vec.cbegin(), vec.cbegin() + 2 );          // shifts 10
+    vec.pop_front();                                      // shifts 9
+    ShiftSample more[] = { { 1 }, { 2 } };
+    vec.insert( vec.cbegin() + 8, more, more + 2 );       // shifts 1
+    EXPECT_EQ( c.elements_shifted.load(), 10u + 6 + 10 + 9 + 1 );
+}
+
+TEST(Stats, CountedTrimmedStillTrims)
+{
+    // Counting must not change behaviour: counted<trimmed<>> shrinks exactly like trimmed<>.
+    using counted_trimmed = sc::vector<int, std::allocator<int>, sc::stats::counted<sc::growth::trimmed<> > >;
+    static_assert( sc::growth::is_trimmed< sc::stats::counted<sc::growth::trimmed<> > >::value,
+                   "counted must forward auto-trim" );
+
+    counted_trimmed vec;
+    for ( auto i{0} ; i < 1000 ; ++i )
+        vec.push_back( i );
+    ASSERT_EQ( vec.capacity(), 1024u );
+    vec.erase( vec.begin(), vec.begin() + 745 );
+    ASSERT_EQ( vec.size(), 255u );
+    ASSERT_EQ( vec.capacity(), 510u );
+    ASSERT_EQ( vec.front(), 745 );
+    ASSERT_EQ( vec.back(), 999 );
+}
+
+TEST(Stats, TrimmedPushPopCycleDoesNotReallocate)
+{
+    // Hovering around empty must not allocate and free on every operation.
+    using cycle_vector = sc::vector<CycleSample, std::allocator<CycleSample>, sc::stats::counted<sc::growth::trimmed<> > >;
+    auto & c = sc::stats::counters_for< cycle_vector >();
+
+    cycle_vector vec;
+    for ( auto i{0} ; i < 1000 ; ++i ) {
+        vec.push_back( CycleSample{ i } );
+        vec.pop_back();
+    }
+    EXPECT_EQ( c.reallocations.load(), 1u );
+    EXPECT_EQ( vec.capacity(), 1u );
+
+    // After a spike, draining to empty shrinks to the policy's minimum and cycling costs nothing more.
+    for ( auto i{0} ; i < 1000 ; ++i )
+        vec.push_back( CycleSample{ i } );
+    vec.clear();
+    ASSERT_EQ( vec.capacity(), 16u );
+    c.reset();
+    for ( auto i{0} ; i < 1000 ; ++i ) {
+        vec.push_back( CycleSample{ i } );
+        vec.pop_back();
+    }
+    EXPECT_EQ( c.reallocations.load(), 0u );
+}
+
+TEST(Stats, JsonDump)
+{
+    {
+        counted_vector<std::string> vec{ "a", "b" };
+        vec.push_back( "c" );
+    }
+    std::string json = sc::stats::registry::instance().to_json();
+    EXPECT_NE( json.find( "GrowthSample" ), std::string::npos );
+    EXPECT_NE( json.find( "\"reallocations\": " ), std::string::npos );
+    EXPECT_NE( json.find( "std::__cxx11::basic_string" ), std::string::npos );
+    EXPECT_EQ( json.front(), '{' );
+
+#ifndef SC_VECTOR_STATS
+    // Without SC_VECTOR_STATS, vectors with the default policy never register anything.
+    sc::vector<double> plain{ 1.0 };
+    plain.push_back( 2.0 );
+    EXPECT_EQ( sc::stats::registry::instance().to_json().find( "double" ), std::string::npos );
+#endif
+}